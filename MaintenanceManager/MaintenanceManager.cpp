@@ -39,7 +39,13 @@
 #include <bits/stdc++.h>
 #include <algorithm>
 #include <array>
+#include <random>
 #include <unistd.h>
+#include <sys/wait.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <sys/inotify.h>
 #include <secure_wrapper.h>
 
 #include "MaintenanceManager.h"
@@ -47,6 +53,9 @@
 #include "UtilsJsonRpc.h"
 #include "UtilsfileExists.h"
 #include "UtilsgetFileContent.h"
+#include "UtilsSpawn.h"
+#include "UtilsTelemetry.h"
+#include "UtilsTimeZone.h"
 
 #include <telemetry_busmessage_sender.h>
 
@@ -70,7 +79,6 @@ using namespace std;
 #define API_VERSION_NUMBER_PATCH 24
 #define SERVER_DETAILS "127.0.0.1:9998"
 
-#define PROC_DIR "/proc"
 #define RDK_PATH "/lib/rdk/"
 #define MAINTENANCE_MANAGER_RFC_CALLER_ID "MaintenanceManager"
 
@@ -89,6 +97,23 @@ enum TaskIndices {
     TASK_LOGUPLOAD
 };
 
+/* Event sources of the task supervisor, stored with the task index in epoll_event.data.u64 */
+enum SupervisorEvents {
+    SUPERVISOR_WAKEUP = 0,
+    SUPERVISOR_TIMER,
+    SUPERVISOR_PROCESS,
+    SUPERVISOR_FILES,
+    SUPERVISOR_START_TIME,
+    SUPERVISOR_PROC_EVENTS,
+    SUPERVISOR_CYCLE
+};
+#define SUPERVISOR_EVENT(TYPE, INDEX) (((uint64_t)(TYPE) << 32) | (uint32_t)(INDEX))
+
+#if defined(GTEST_ENABLE)
+/* Process ID of a task started through m_spawn_stub, above any pid_max so no signal reaches a process */
+#define SIMULATED_TASK_PID INT_MAX
+#endif
+
 /**
  * @brief Converts a maintenance status enum to its corresponding string representation.
  *
@@ -130,6 +155,87 @@ string notifyStatusToString(Maint_notify_status_t &status)
     return ret_status;
 }
 
+/**
+ * @brief Converts a task outcome recorded in the maintenance history to a string.
+ *
+ * @param outcome One of the values from the `Maint_task_outcome_t` enum.
+ * @return The name of the outcome without the TASK_OUTCOME_ prefix, "NOT_RUN" if unknown.
+ */
+string taskOutcomeToString(uint8_t outcome)
+{
+    switch (outcome)
+    {
+        case TASK_OUTCOME_RUNNING:
+            return "RUNNING";
+        case TASK_OUTCOME_SUCCESS:
+            return "SUCCESS";
+        case TASK_OUTCOME_ERROR:
+            return "ERROR";
+        case TASK_OUTCOME_SKIPPED:
+            return "SKIPPED";
+        case TASK_OUTCOME_TIMEOUT:
+            return "TIMEOUT";
+        case TASK_OUTCOME_ABORTED:
+            return "ABORTED";
+        case TASK_OUTCOME_RESUMED:
+            return "RESUMED";
+        default:
+            return "NOT_RUN";
+    }
+}
+
+/**
+ * @brief Derives the offset of a device's maintenance start time from its identifier.
+ *
+ * The identifier is hashed with FNV-1a and mixed with the splitmix64 finalizer,
+ * so identifiers differing in one character, such as consecutive MAC addresses,
+ * land far apart and a fleet spreads evenly over the window.
+ *
+ * @param device_id A stable identifier of the device.
+ * @param window The width of the spread in seconds.
+ * @return The offset in seconds, in [0, window), 0 if the window is 0.
+ */
+uint32_t startTimeJitter(const string &device_id, uint32_t window)
+{
+    if (window == 0)
+    {
+        return 0;
+    }
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : device_id)
+    {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+    hash ^= hash >> 31;
+    return (uint32_t)(hash % window);
+}
+
+/**
+ * @brief Converts a power state reported by org.rdk.PowerManager.
+ *
+ * @param state The state, such as POWER_STATE_STANDBY_DEEP_SLEEP.
+ * @return The matching `Maint_power_state_t`, MAINT_POWER_UNKNOWN if not recognized.
+ */
+Maint_power_state_t powerStateFromManager(WPEFramework::Exchange::IPowerManager::PowerState state)
+{
+    switch (state)
+    {
+        case WPEFramework::Exchange::IPowerManager::POWER_STATE_ON:
+            return MAINT_POWER_ON;
+        case WPEFramework::Exchange::IPowerManager::POWER_STATE_STANDBY:
+        case WPEFramework::Exchange::IPowerManager::POWER_STATE_STANDBY_LIGHT_SLEEP:
+            return MAINT_POWER_LIGHT_STANDBY;
+        case WPEFramework::Exchange::IPowerManager::POWER_STATE_STANDBY_DEEP_SLEEP:
+            return MAINT_POWER_DEEP_STANDBY;
+        case WPEFramework::Exchange::IPowerManager::POWER_STATE_OFF:
+            return MAINT_POWER_OFF;
+        default:
+            return MAINT_POWER_UNKNOWN;
+    }
+}
+
 /**
  * @brief Checks if a given Opt-out mode is valid.
  *
@@ -268,45 +374,43 @@ namespace WPEFramework
 
         cSettings MaintenanceManager::m_setting(MAINTENANCE_MGR_RECORD_FILE);
 
-        /* Static Member Definitions */
-        timer_t MaintenanceManager::timerid;
-        string MaintenanceManager::currentTask;
-        bool MaintenanceManager::g_task_timerCreated = false;
-
-        string task_param[] = {
-            "RFC",
-            "SWUPDATE",
-            "LOGUPLOAD"
-        };
+#ifdef ENABLE_RFC_MANAGER
+#define RFC_PROCESS_NAME "rfcMgr"
+#else
+#define RFC_PROCESS_NAME "RFCbase.sh"
+#endif
 
-        string task_names_foreground[] = {
-            string(TASK_SCRIPT) + " " + task_param[TASK_RFC],
-            string(TASK_SCRIPT) + " " + task_param[TASK_SWUPDATE],
-            string(TASK_SCRIPT) + " " + task_param[TASK_LOGUPLOAD]
+        /* Built-in tasks, indexed by TaskIndices. A task may start once the
+         * tasks it depends on have completed (successfully or not); tasks
+         * that may start are started in priority order, up to
+         * m_max_parallel_tasks at once. The download and the log upload are
+         * held while the device is in use. */
+        const Maint_task_definition_t default_tasks[MAX_MAINTENANCE_TASKS] = {
+            {"RFC", string(TASK_SCRIPT) + " RFC", RFC_PROCESS_NAME,
+             MAINT_RFC_COMPLETE, MAINT_RFC_ERROR, MAINT_RFC_INPROGRESS,
+             RFC_SUCCESS, RFC_COMPLETE, 0, 0, TASK_RETRY_COUNT + 1,
+             TASK_TIMEOUT, TASK_RETRY_DELAY, TASK_RETRY_DELAY_MAX, false},
+            {"SWUPDATE", string(TASK_SCRIPT) + " SWUPDATE", "rdkvfwupgrader",
+             MAINT_FWDOWNLOAD_COMPLETE, MAINT_FWDOWNLOAD_ERROR, MAINT_FWDOWNLOAD_INPROGRESS,
+             SWUPDATE_SUCCESS, SWUPDATE_COMPLETE, (1 << TASK_RFC), 1, TASK_RETRY_COUNT + 1,
+             TASK_TIMEOUT, TASK_RETRY_DELAY, TASK_RETRY_DELAY_MAX, true},
+            {"LOGUPLOAD", string(TASK_SCRIPT) + " LOGUPLOAD", "uploadSTBLogs.sh",
+             MAINT_LOGUPLOAD_COMPLETE, MAINT_LOGUPLOAD_ERROR, MAINT_LOGUPLOAD_INPROGRESS,
+             LOGUPLOAD_SUCCESS, LOGUPLOAD_COMPLETE, (1 << TASK_RFC), 2, TASK_RETRY_COUNT + 1,
+             TASK_TIMEOUT, TASK_RETRY_DELAY, TASK_RETRY_DELAY_MAX, true}
         };
 
-        vector<string> tasks;
-
-        const int task_complete_status[] = {
-            RFC_COMPLETE,
-            SWUPDATE_COMPLETE,
-            LOGUPLOAD_COMPLETE
-        };
+        vector<int> tasks;
 
-        std::map<string, int> task_status_map = {
-            {string(TASK_SCRIPT) + " " + task_param[TASK_RFC], RFC_COMPLETE},
-            {string(TASK_SCRIPT) + " " + task_param[TASK_SWUPDATE], SWUPDATE_COMPLETE},
-            {string(TASK_SCRIPT) + " " + task_param[TASK_LOGUPLOAD], LOGUPLOAD_COMPLETE}
-        };
+        int CalculateStartTime();
+        int CalculateStartTime(time_t rawtime);
 
-        string task_names[] = {
-#ifdef ENABLE_RFC_MANAGER
-            "rfcMgr",
-#else
-            "RFCbase.sh",
-#endif
-            "rdkvfwupgrader",
-            "uploadSTBLogs.sh"
+        /* Files CalculateStartTime() reads, watched to invalidate the cached start time */
+        static const char *start_time_files[][2] = {
+            {"/opt", "rdk_maintenance.conf"},
+            {"/etc", "device.properties"},
+            {"/opt/persistent", "timeZoneDST"},
+            {"/etc", "timeZone_offset_map"}
         };
 
         static const array<string, 3> kDeviceInitContextKeyVals = {
@@ -315,16 +419,51 @@ namespace WPEFramework
             "regionalConfigService"
         };
 
+        /* Errors meaning the websocket of a JSON-RPC link is unusable */
+        static bool isLinkFailure(uint32_t status)
+        {
+            return (status == Core::ERROR_ASYNC_FAILED) || (status == Core::ERROR_CONNECTION_CLOSED) || (status == Core::ERROR_TIMEDOUT);
+        }
+
         /**
          * Register MaintenanceManager module as wpeframework plugin
          */
         MaintenanceManager::MaintenanceManager()
             : PluginHost::JSONRPC(), 
               m_notify_status(MAINTENANCE_IDLE),
+              m_status_version(0),
+              m_history(MAINTENANCE_MGR_HISTORY_FILE, sizeof(HistoryRecord), MAINTENANCE_HISTORY_SIZE),
+              m_cycle_open(false),
+              m_checkpoint(MAINTENANCE_MGR_CHECKPOINT_FILE, sizeof(CycleCheckpoint)),
+              m_checkpoint_start(0),
+              m_resume_window(DEFAULT_RESUME_WINDOW),
+              m_deinitializing(false),
+              m_optout_stat(),
               m_abort_flag(false),
               g_task_status(0),
+              m_max_parallel_tasks(DEFAULT_MAX_PARALLEL_TASKS),
               g_unsolicited_complete(false),
-              m_authservicePlugin(nullptr)
+              m_power_state(MAINT_POWER_UNKNOWN),
+              m_playback_active(false),
+              m_power_subscribed(false),
+              m_max_deferral(DEFAULT_MAX_DEFERRAL),
+              m_task_background(false),
+              m_authservicePlugin(nullptr),
+              m_epoll_fd(-1),
+              m_wakeup_fd(-1),
+              m_cycle_fd(-1),
+              m_process_index({default_tasks[TASK_RFC].processName, default_tasks[TASK_SWUPDATE].processName, default_tasks[TASK_LOGUPLOAD].processName}),
+              m_inotify_fd(-1),
+              m_start_timerfd(-1),
+              m_maintenance_start_time(-1),
+              m_start_time_cached(false),
+              m_start_jitter(0),
+              m_link_creations(0),
+              m_link_reuses(0),
+              m_internet_state(INTERNET_UNKNOWN_STATE),
+              m_pluginStateSink(this),
+              m_pluginStateRegistered(false),
+              m_powerModeSink(this)
         {
             MaintenanceManager::_instance = this;
 
@@ -340,10 +479,25 @@ namespace WPEFramework
             Register("startMaintenance", &MaintenanceManager::startMaintenance, this);
             Register("stopMaintenance", &MaintenanceManager::stopMaintenance, this);
             Register("getMaintenanceMode", &MaintenanceManager::getMaintenanceMode, this);
+            Register("getMaintenanceHistory", &MaintenanceManager::getMaintenanceHistory, this);
+            Register("getMaintenanceMetrics", &MaintenanceManager::getMaintenanceMetrics, this);
+            Register("setTaskPolicy", &MaintenanceManager::setTaskPolicy, this);
+            Register("setPlaybackState", &MaintenanceManager::setPlaybackState, this);
+            memset(&m_cycle, 0, sizeof(m_cycle));
 
-            MaintenanceManager::m_task_map[task_names_foreground[TASK_RFC].c_str()] = false;
-            MaintenanceManager::m_task_map[task_names_foreground[TASK_SWUPDATE].c_str()] = false;
-            MaintenanceManager::m_task_map[task_names_foreground[TASK_LOGUPLOAD].c_str()] = false;
+            loadTaskRegistry(Core::JSON::ArrayType<TaskConfig>());
+
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                m_task_active[i] = false;
+                m_task_process[i].pid = -1;
+                m_task_process[i].pidfd = -1;
+                m_task_process[i].inCgroup = false;
+                memset(&m_task_process[i].cgroupBase, 0, sizeof(m_task_process[i].cgroupBase));
+                m_task_timerfd[i] = -1;
+                memset(&m_task_usage[i], 0, sizeof(m_task_usage[i]));
+                m_task_runs[i] = 0;
+            }
 
             MaintenanceManager::m_param_map[kDeviceInitContextKeyVals[0].c_str()] = TR181_PARTNER_ID;
             MaintenanceManager::m_param_map[kDeviceInitContextKeyVals[1].c_str()] = TR181_TARGET_OS_CLASS;
@@ -352,20 +506,240 @@ namespace WPEFramework
             MaintenanceManager::m_paramType_map[kDeviceInitContextKeyVals[0].c_str()] = DATA_TYPE::WDMP_STRING;
             MaintenanceManager::m_paramType_map[kDeviceInitContextKeyVals[1].c_str()] = DATA_TYPE::WDMP_STRING;
             MaintenanceManager::m_paramType_map[kDeviceInitContextKeyVals[2].c_str()] = DATA_TYPE::WDMP_STRING;
+
+            publishStatus();
+        }
+
+        /**
+         * @brief Publishes a new status snapshot for getMaintenanceActivityStatus.
+         *
+         * Called with m_statusMutex held after any change of the maintenance
+         * status, the critical maintenance or reboot pending flags, or the
+         * last successful completion time. Readers never see a partial update.
+         */
+        void MaintenanceManager::publishStatus()
+        {
+            std::shared_ptr<StatusSnapshot> snapshot = std::make_shared<StatusSnapshot>();
+            snapshot->version = ++m_status_version;
+            snapshot->status = m_notify_status;
+            snapshot->isCriticalMaintenance = (g_is_critical_maintenance == "true");
+            snapshot->isRebootPending = (g_is_reboot_pending == "true");
+            snapshot->lastSuccessfulCompletionTime = 0;
+            if (m_setting.contains("LastSuccessfulCompletionTime"))
+            {
+                try
+                {
+                    snapshot->lastSuccessfulCompletionTime = stoi(m_setting.getValue("LastSuccessfulCompletionTime").String());
+                }
+                catch (exception &err)
+                {
+                    // exception caught with stoi -- So making "LastSuccessfulCompletionTime" as 0
+                }
+            }
+            std::atomic_store(&m_status_snapshot, std::shared_ptr<const StatusSnapshot>(std::move(snapshot)));
+        }
+
+        /**
+         * @brief Starts recording a maintenance cycle for getMaintenanceHistory.
+         */
+        void MaintenanceManager::beginHistoryCycle()
+        {
+            std::lock_guard<std::mutex> lock(m_historyMutex);
+            memset(&m_cycle, 0, sizeof(m_cycle));
+            m_cycle.startTime = time(nullptr);
+            m_cycle.type = (uint8_t)g_maintenance_type;
+            m_cycle_open = true;
+        }
+
+        /**
+         * @brief Adds time spent waiting for the network to the current cycle.
+         *
+         * @param wait_ms Milliseconds spent in isDeviceOnline().
+         */
+        void MaintenanceManager::recordNetworkWait(uint32_t wait_ms)
+        {
+            std::lock_guard<std::mutex> lock(m_historyMutex);
+            if (m_cycle_open)
+            {
+                m_cycle.networkWaitMs += wait_ms;
+            }
+        }
+
+        /**
+         * @brief Adds the time elapsed since start to the latency histogram of a phase.
+         *
+         * @param phase The phase that just finished.
+         * @param start When the phase started.
+         * @return The elapsed time in milliseconds.
+         */
+        uint32_t MaintenanceManager::recordPhase(Maint_phase_t phase, std::chrono::steady_clock::time_point start)
+        {
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            uint32_t elapsed_ms = (elapsed > (int64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+            m_phase_latency[phase].record(elapsed_ms);
+            return elapsed_ms;
+        }
+
+        /**
+         * @brief Records a task attempt or outcome in the current cycle.
+         *
+         * TASK_OUTCOME_RUNNING counts an invocation attempt. The first final
+         * outcome after it sets the end time; later ones are ignored.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param outcome What happened to the task.
+         */
+        void MaintenanceManager::recordTaskOutcome(int task_index, Maint_task_outcome_t outcome)
+        {
+            std::lock_guard<std::mutex> lock(m_historyMutex);
+            if (!m_cycle_open)
+            {
+                return;
+            }
+            auto &task = m_cycle.tasks[task_index];
+            if (outcome == TASK_OUTCOME_RUNNING)
+            {
+                if (task.attempts == 0)
+                {
+                    task.startTime = time(nullptr);
+                }
+                task.attempts++;
+                task.outcome = outcome;
+                m_task_started[task_index] = std::chrono::steady_clock::now();
+            }
+            else if (task.outcome == TASK_OUTCOME_RUNNING || task.outcome == TASK_OUTCOME_NOT_RUN)
+            {
+                /* a task phase ends when the task reports through IARM (or fails to start) */
+                if (task.outcome == TASK_OUTCOME_RUNNING && (outcome == TASK_OUTCOME_SUCCESS || outcome == TASK_OUTCOME_ERROR))
+                {
+                    recordPhase((Maint_phase_t)(PHASE_TASK_RFC + task_index), m_task_started[task_index]);
+                }
+                task.endTime = time(nullptr);
+                task.outcome = outcome;
+            }
+        }
+
+        /**
+         * @brief Ends the current cycle and appends it to the history file.
+         *
+         * @param status The status the cycle ended with.
+         */
+        void MaintenanceManager::endHistoryCycle(Maint_notify_status_t status)
+        {
+            HistoryRecord record;
+            {
+                std::lock_guard<std::mutex> lock(m_historyMutex);
+                if (!m_cycle_open)
+                {
+                    return;
+                }
+                m_cycle_open = false;
+                m_cycle.endTime = time(nullptr);
+                m_cycle.status = (uint8_t)status;
+                for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+                {
+                    if (m_cycle.tasks[i].outcome == TASK_OUTCOME_RUNNING)
+                    {
+                        m_cycle.tasks[i].endTime = m_cycle.endTime;
+                        m_cycle.tasks[i].outcome = TASK_OUTCOME_ABORTED;
+                    }
+                }
+                record = m_cycle;
+            }
+            if (!m_history.append(&record))
+            {
+                MM_LOGERR("Failed to record the maintenance cycle in %s", MAINTENANCE_MGR_HISTORY_FILE);
+            }
+        }
+
+        /**
+         * @brief Picks up a cycle a restart interrupted.
+         *
+         * Called by the maintenance thread of an unsolicited cycle. If the
+         * checkpoint holds a cycle that was still open and started within the
+         * resume window, the tasks that had succeeded are set complete and
+         * recorded as resumed instead of running again, and the checkpoint
+         * keeps the identity of the interrupted cycle. A cycle whose tasks had
+         * all succeeded ended right after its last task and is not resumed.
+         *
+         * @return The resumed tasks, as a bitmask of task ids.
+         */
+        uint8_t MaintenanceManager::resumeCycle()
+        {
+            CycleCheckpoint checkpoint;
+            const uint8_t all_tasks = (1 << MAX_MAINTENANCE_TASKS) - 1;
+            int64_t now = time(nullptr);
+
+            if (m_resume_window == 0 || !m_checkpoint.load(&checkpoint) || !checkpoint.open)
+            {
+                return 0;
+            }
+            if (now < checkpoint.startTime || now - checkpoint.startTime > (int64_t)m_resume_window)
+            {
+                MM_LOGINFO("Interrupted cycle of %lld is outside the resume window", (long long)checkpoint.startTime);
+                return 0;
+            }
+            if ((checkpoint.done & all_tasks) == all_tasks)
+            {
+                return 0;
+            }
+
+            MM_LOGINFO("Resuming the cycle of %lld interrupted by a restart", (long long)checkpoint.startTime);
+            m_checkpoint_start = checkpoint.startTime;
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                if (checkpoint.done & (1 << i))
+                {
+                    MM_LOGINFO("%s already completed, not run again", m_tasks[i].name.c_str());
+                    SET_STATUS(g_task_status, m_tasks[i].successBit);
+                    SET_STATUS(g_task_status, m_tasks[i].completeBit);
+                    recordTaskOutcome(i, TASK_OUTCOME_RESUMED);
+                }
+            }
+            return checkpoint.done & all_tasks;
+        }
+
+        /**
+         * @brief Stores the tasks of the current cycle that have succeeded.
+         *
+         * The checkpoint is written and synced only when its content changes,
+         * which is once when the cycle starts, once per successful task and
+         * once when the cycle is done.
+         *
+         * @param open false once the maintenance thread is done with the cycle.
+         */
+        void MaintenanceManager::saveCheckpoint(bool open)
+        {
+            CycleCheckpoint checkpoint;
+            memset(&checkpoint, 0, sizeof(checkpoint));
+            {
+                std::lock_guard<std::mutex> lock(m_historyMutex);
+                checkpoint.type = m_cycle.type;
+                for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+                {
+                    if (m_cycle.tasks[i].outcome == TASK_OUTCOME_SUCCESS || m_cycle.tasks[i].outcome == TASK_OUTCOME_RESUMED)
+                    {
+                        checkpoint.done |= (1 << i);
+                    }
+                }
+            }
+            checkpoint.startTime = m_checkpoint_start;
+            checkpoint.open = open ? 1 : 0;
+            if (!m_checkpoint.store(&checkpoint))
+            {
+                MM_LOGERR("Failed to write the maintenance checkpoint %s: %s", MAINTENANCE_MGR_CHECKPOINT_FILE, strerror(errno));
+            }
         }
 
         void MaintenanceManager::task_execution_thread()
         {
-            int i = 0;
-            string task = "";
             bool internetConnectStatus = false;
             bool delayMaintenanceStarted = false;
             bool exitOnNoNetwork = false;
-            int retry_count = TASK_RETRY_COUNT;
-            bool isTaskTimerStarted = false;
 
             std::unique_lock<std::mutex> wailck(m_waiMutex);
             MM_LOGINFO("Executing Maintenance tasks");
+            beginHistoryCycle();
 
             /* Purposefully delaying MAINTENANCE_STARTED status to honor POWER compliance */
             if (UNSOLICITED_MAINTENANCE == g_maintenance_type && g_whoami_support_enabled)
@@ -390,7 +764,9 @@ namespace WPEFramework
             if (!g_whoami_support_enabled && g_suppress_maintenance_enabled)
             {   
                 MM_LOGINFO("WhoAmI feature is disabled and suppress maintenance is enabled");
+                auto phaseStart = std::chrono::steady_clock::now();
                 bool activationStatus = getActivatedStatus(skipFirmwareCheck); /* Activation check */
+                recordPhase(PHASE_ACTIVATION, phaseStart);
                 /* we proceed with network check only if
                 * "activation-connect",
                 * "activation-ready"
@@ -398,12 +774,16 @@ namespace WPEFramework
                 * "activated" */
                 if (activationStatus)
                 {
+                    phaseStart = std::chrono::steady_clock::now();
                     internetConnectStatus = isDeviceOnline(); /* Network check */
+                    recordNetworkWait(recordPhase(PHASE_NETWORK, phaseStart));
                 }
             }
 	    else
             {
+                auto phaseStart = std::chrono::steady_clock::now();
                 internetConnectStatus = isDeviceOnline(); /* Network check */
+                recordNetworkWait(recordPhase(PHASE_NETWORK, phaseStart));
             }
 
             if (g_whoami_support_enabled)
@@ -411,7 +791,10 @@ namespace WPEFramework
                 MM_LOGINFO("WhoAmI feature is enabled");
                 if (UNSOLICITED_MAINTENANCE == g_maintenance_type)
                 {
+                    auto phaseStart = std::chrono::steady_clock::now();
                     string activation_status = checkActivatedStatus(); /* Device Activation Status Check */
+                    recordPhase(PHASE_ACTIVATION, phaseStart);
+                    phaseStart = std::chrono::steady_clock::now();
                     bool whoAmIStatus = knowWhoAmI(activation_status); /* WhoAmI Response & Set Status Check */
                     MM_LOGINFO("knowWhoAmI() returned %s", (whoAmIStatus) ? "successfully" : "false");
 
@@ -427,6 +810,8 @@ namespace WPEFramework
                         MM_LOGINFO("Device is not connected to the Internet and Device is already Activated");
                         exitOnNoNetwork = true;
                     }
+                    /* includes waiting for onDeviceInitializationContextUpdate */
+                    recordPhase(PHASE_WHOAMI, phaseStart);
                 }
                 else /* Solicited Maintenance in WHOAMI */
                 {
@@ -445,6 +830,13 @@ namespace WPEFramework
                 }
             }
             
+            if (exitOnNoNetwork && m_abort_flag)
+            {
+                /* stopMaintenanceTasks() holds m_statusMutex while it joins this thread and reports the error */
+                MM_LOGINFO("Maintenance was stopped while waiting for the network");
+                return;
+            }
+
             if (exitOnNoNetwork) /* Exit Maintenance Cycle if no Internet */
             {
                 m_statusMutex.lock();
@@ -452,9 +844,7 @@ namespace WPEFramework
                 m_statusMutex.unlock();
                 MM_LOGINFO("Maintenance is exiting as device is not connected to internet.");
 
-#if !defined(GTEST_ENABLE)
-				t2_event_d("SYST_ERR_MaintNetworkFail", 1);
-#endif
+				Utils::Telemetry::batcher().count("SYST_ERR_MaintNetworkFail");
 				
                 if (UNSOLICITED_MAINTENANCE == g_maintenance_type && !g_unsolicited_complete)
                 {
@@ -476,9 +866,7 @@ namespace WPEFramework
 
 			if (UNSOLICITED_MAINTENANCE != g_maintenance_type) 
 			{
-#if !defined(GTEST_ENABLE)
-				t2_event_d("SYST_INFO_SOMT", 1);
-#endif
+				Utils::Telemetry::batcher().count("SYST_INFO_SOMT");
 			}
 			
             if (!g_whoami_support_enabled && g_suppress_maintenance_enabled && skipFirmwareCheck)
@@ -486,150 +874,1110 @@ namespace WPEFramework
                 /* set the task status of Firmware Download */
                 SET_STATUS(g_task_status, SWUPDATE_SUCCESS);
                 SET_STATUS(g_task_status, SWUPDATE_COMPLETE);
+                recordTaskOutcome(TASK_SWUPDATE, TASK_OUTCOME_SKIPPED);
                 /* Skip Firmware Download Task and add other tasks */
-                tasks.push_back(task_names_foreground[TASK_RFC].c_str());
-                tasks.push_back(task_names_foreground[TASK_LOGUPLOAD].c_str());
+                tasks.push_back(TASK_RFC);
+                tasks.push_back(TASK_LOGUPLOAD);
             }
 	    else
             {
-                tasks.push_back(task_names_foreground[TASK_RFC].c_str());
-                tasks.push_back(task_names_foreground[TASK_SWUPDATE].c_str());
-                tasks.push_back(task_names_foreground[TASK_LOGUPLOAD].c_str());
+                tasks.push_back(TASK_RFC);
+                tasks.push_back(TASK_SWUPDATE);
+                tasks.push_back(TASK_LOGUPLOAD);
+            }
+
+            /* A cycle started on bootup continues one that a restart interrupted */
+            {
+                std::lock_guard<std::mutex> lock(m_historyMutex);
+                m_checkpoint_start = m_cycle.startTime;
+            }
+            if (UNSOLICITED_MAINTENANCE == g_maintenance_type)
+            {
+                uint8_t resumed = resumeCycle();
+                tasks.erase(std::remove_if(tasks.begin(), tasks.end(), [resumed](int task_index) {
+                    return (resumed & (1 << task_index)) != 0;
+                }), tasks.end());
+            }
+            saveCheckpoint(true);
+
+            /* PowerManager may have been activated after this plugin */
+            if (m_max_deferral > 0 && !m_power_subscribed)
+            {
+                m_power_subscribed = subscribeToPowerStateEvents();
             }
 
             std::unique_lock<std::mutex> lck(m_callMutex);
-            for (i = 0; i < static_cast<int>(tasks.size()) && !m_abort_flag; i++)
+            std::vector<int> pending(tasks.begin(), tasks.end());
+            std::vector<int> running;
+            /* Tasks that could not be started, with the time of their next attempt */
+            std::vector<std::pair<int, std::chrono::steady_clock::time_point>> retrying;
+            int attempts[MAX_MAINTENANCE_TASKS] = {0};
+            /* Deferrable tasks are held while the device is in use, until this time */
+            bool deferring = false;
+            std::chrono::steady_clock::time_point defer_until;
+            auto byPriority = [this](int a, int b) {
+                return m_tasks[a].priority < m_tasks[b].priority;
+            };
+            std::stable_sort(pending.begin(), pending.end(), byPriority);
+            MM_LOGINFO("Scheduling %d tasks, at most %d in parallel", (int)pending.size(), (int)m_max_parallel_tasks);
+#if defined(GTEST_ENABLE)
+            /* Unless a test reports the task results, a task is finished once started */
+            const bool wait_for_tasks = m_wait_for_task_events;
+#else
+            const bool wait_for_tasks = true;
+#endif
+
+            while (!m_abort_flag && (!pending.empty() || !running.empty() || !retrying.empty()))
             {
-                int task_status = -1;
-                task = tasks[i];
-                currentTask = task;
-                task += " &";
-                task += "\0";
-                if (!m_abort_flag)
+                /* Start every pending task whose dependencies have completed,
+                 * in priority order, until the parallel limit is reached */
+                bool progressed = false;
+                bool held = false;
+                for (auto it = pending.begin(); it != pending.end() && !m_abort_flag && running.size() < (size_t)m_max_parallel_tasks;)
                 {
-                    if (retry_count == TASK_RETRY_COUNT)
-                    {
-                        MM_LOGINFO("Starting Timer for %s", currentTask.c_str());
-                        isTaskTimerStarted = task_startTimer();
-                    }
-                    if (isTaskTimerStarted)
+                    int task_index = *it;
+                    if (!taskDependenciesCompleted(task_index))
                     {
-                        m_task_map[tasks[i]] = true;
-                        MM_LOGINFO("Starting Task %s", task.c_str());
-                        task_status = system(task.c_str());
+                        ++it;
+                        continue;
                     }
-                    /* Set task_status purposefully to non-zero value to verify failure logic*/
-                    // task_status = -1;
-                    if (task_status != 0) /* system() call fails */
+                    if (deferTask(task_index))
                     {
-                        m_task_map[tasks[i]] = false;
-                        MM_LOGINFO("%s invocation failed with return status %d", tasks[i].c_str(), WEXITSTATUS(task_status));
-                        if (retry_count > 0 && isTaskTimerStarted)
+                        auto now = std::chrono::steady_clock::now();
+                        if (!deferring)
                         {
-                            MM_LOGINFO("Retry %s after %d seconds (%d retry left)\n", tasks[i].c_str(), TASK_RETRY_DELAY, retry_count);
-                            std::this_thread::sleep_for(std::chrono::seconds(TASK_RETRY_DELAY));
-                            i--; /* Decrement iterator to retry the same task again */
-                            retry_count--;
-                            continue;
+                            deferring = true;
+                            defer_until = now + std::chrono::seconds(m_max_deferral);
+                            MM_LOGINFO("Device in use, holding deferrable tasks for up to %u seconds", m_max_deferral);
                         }
-                        else
+                        if (now < defer_until)
                         {
-                            MM_LOGINFO("Task Failed");
-                            auto it = task_status_map.find(tasks[i]);
-                            if (it != task_status_map.end())
-                            {
-                                MM_LOGINFO("Setting task as Error");
-                                int complete_status = it->second;
-                                SET_STATUS(g_task_status, complete_status);
-                            }
-                            if (task_stopTimer())
-                            {
-                                MM_LOGINFO("Stopped Timer Successfully");
-                            }
-                            else
-                            {
-                                MM_LOGERR("task_stopTimer() did not stop the Timer");
-                            }
+                            held = true;
+                            ++it;
+                            continue;
                         }
+                        MM_LOGWARN("Starting %s while the device is in use, held for the maximum deferral", m_tasks[task_index].command.c_str());
                     }
-                    else /* system() executes successfully */
+                    it = pending.erase(it);
+                    progressed = true;
+                    attempts[task_index]++;
+                    if (launchTask(task_index))
                     {
-                        MM_LOGINFO("Waiting to unlock.. [%d/%d]", i + 1, (int)tasks.size());
-#if !defined(GTEST_ENABLE)
-                        task_thread.wait(lck);
-#endif
-                        if (task_stopTimer())
-                        {
-                            MM_LOGINFO("Stopped Timer Successfully");
-                        }
-                        else
-                        {
-                            MM_LOGERR("task_stopTimer() did not stop the Timer");
-                        }
+                        running.push_back(task_index);
+                    }
+                    else if (attempts[task_index] < m_tasks[task_index].attempts && !m_abort_flag)
+                    {
+                        std::chrono::milliseconds delay = retryDelay(task_index, attempts[task_index]);
+                        MM_LOGINFO("Retry %s after %lld ms (%d attempts left)", m_tasks[task_index].command.c_str(),
+                                   (long long)delay.count(), m_tasks[task_index].attempts - attempts[task_index]);
+                        retrying.emplace_back(task_index, std::chrono::steady_clock::now() + delay);
+                    }
+                    else
+                    {
+                        failTask(task_index);
+                    }
+                }
+
+                if (running.empty() && retrying.empty() && !held)
+                {
+                    if (progressed)
+                    {
+                        /* a failed launch may have released its dependents */
+                        continue;
+                    }
+                    if (!pending.empty())
+                    {
+                        MM_LOGERR("%d task(s) left with unmet dependencies", (int)pending.size());
+                    }
+                    break;
+                }
+
+                MM_LOGINFO("Waiting to unlock.. [%d running, %d retrying, %d pending%s]", (int)running.size(), (int)retrying.size(), (int)pending.size(), held ? ", held" : "");
+                if (!retrying.empty() || held)
+                {
+                    /* stopMaintenance wakes the wait, so a backoff or deferral never delays it;
+                     * held tasks are reconsidered as soon as the device is no longer in use */
+                    auto next = held ? defer_until : std::chrono::steady_clock::time_point::max();
+                    for (const auto &retry : retrying)
+                    {
+                        next = std::min(next, retry.second);
+                    }
+                    task_thread.wait_until(lck, next, [this, &running, held] { return m_abort_flag || anyTaskCompleted(running) || (held && !deviceInUse()); });
+                }
+                else if (wait_for_tasks)
+                {
+                    task_thread.wait(lck, [this, &running] { return m_abort_flag || anyTaskCompleted(running); });
+                }
+                for (auto it = running.begin(); it != running.end();)
+                {
+                    if (wait_for_tasks && !CHECK_STATUS(g_task_status, m_tasks[*it].completeBit))
+                    {
+                        ++it;
+                        continue;
+                    }
+                    MM_LOGINFO("%s finished", m_tasks[*it].command.c_str());
+                    task_stopTimer(*it);
+                    reapTask(*it);
+                    it = running.erase(it);
+                }
+                saveCheckpoint(true);
+
+                /* Tasks whose backoff has passed are started again in priority order */
+                auto now = std::chrono::steady_clock::now();
+                for (auto it = retrying.begin(); it != retrying.end();)
+                {
+                    if (it->second > now)
+                    {
+                        ++it;
+                        continue;
                     }
+                    pending.push_back(it->first);
+                    it = retrying.erase(it);
                 }
-                retry_count = TASK_RETRY_COUNT; /* Reset Retry Count for next Task*/
+                std::stable_sort(pending.begin(), pending.end(), byPriority);
+            }
+            /* Tasks still waiting for a retry when the cycle was stopped */
+            for (const auto &retry : retrying)
+            {
+                failTask(retry.first);
             }
             if (m_abort_flag)
             {
                 m_abort_flag = false;
-                if (task_stopTimer())
+                if (task_stopAllTimers())
                 {
-                    MM_LOGINFO("Stopped Timer Successfully");
+                    MM_LOGINFO("Stopped Timers Successfully");
                 }
                 else
                 {
-                    MM_LOGERR("task_stopTimer() did not stop the Timer");
+                    MM_LOGERR("task_stopAllTimers() did not stop the Timers");
                 }
             }
+            /* A cycle stopped because the plugin goes down is resumed by the next
+             * activation; once stopped or complete otherwise, a restart starts anew */
+            saveCheckpoint(m_deinitializing);
+            /* Tasks still exiting are collected by the supervisor, or on their
+             * next launch when the kernel has no pidfd support */
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                reapTask(i);
+            }
             MM_LOGINFO("Worker Thread Completed");
         } /* end of task_execution_thread() */
 
-        bool MaintenanceManager::isWhoAmIEnabled()
+        /**
+         * @brief Drains pending inotify events for the start time files.
+         *
+         * @return true if any of the files CalculateStartTime() reads has changed.
+         */
+        bool MaintenanceManager::startTimeFilesChanged()
         {
-            bool wai_enabled = false;
-            std::string wai_prop_val;
-            if (!Utils::readPropertyFromFile(DEVICE_PROP_FILE, WHOAMI_PROP_KEY, wai_prop_val)) {
-                MM_LOGERR("Failed to read %s property", WHOAMI_PROP_KEY);
-                return wai_enabled;
-            }
+            char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+            bool changed = false;
+            ssize_t len;
 
-            wai_enabled = (wai_prop_val == "true");
-            return wai_enabled;
+            while ((len = read(m_inotify_fd, buffer, sizeof(buffer))) > 0)
+            {
+                for (char *ptr = buffer; ptr < buffer + len; ptr += sizeof(struct inotify_event) + ((struct inotify_event *)ptr)->len)
+                {
+                    const struct inotify_event *event = (const struct inotify_event *)ptr;
+                    if (event->mask & IN_Q_OVERFLOW)
+                    {
+                        changed = true;
+                        continue;
+                    }
+                    for (size_t i = 0; event->len > 0 && i < sizeof(start_time_files) / sizeof(start_time_files[0]); i++)
+                    {
+                        if (strcmp(event->name, start_time_files[i][1]) == 0)
+                        {
+                            changed = true;
+                        }
+                    }
+                }
+            }
+            return changed;
         }
 
         /**
-         * @brief Determines the device identity by querying the Security Manager.
+         * @brief Sets how long after the configured time this device starts maintenance.
          *
-         * This function repeatedly attempts to query the Security Manager (`org.rdk.SecManager`)
-         * for the device initialization context until the Security Manager is activated or the device
-         * is already activated. If the Security Manager provides a valid device initialization context,
-         * it sets this context using the `setDeviceInitializationContext` method.
+         * The offset is derived from the identifier in device_id_file and saved
+         * with its window, so a device that cannot read the identifier at bootup
+         * keeps the start time it had before.
          *
-         * @param activation_status A reference to a string containing the current activation status of the device.
-         *                          This status is used to determine if retries are needed.
-         * @return true if the device initialization context was successfully obtained and set, false otherwise.
+         * @param device_id_file File holding a stable identifier of the device.
+         * @param window Seconds the start times are spread over, 0 to disable.
          */
-        bool MaintenanceManager::knowWhoAmI(string &activation_status)
+        void MaintenanceManager::loadStartTimeJitter(const string& device_id_file, uint32_t window)
+        {
+            uint32_t jitter = 0;
+            string device_id;
+            if (window > MAX_START_WINDOW)
+            {
+                MM_LOGWARN("Start window %u is above %d seconds, using %d", window, MAX_START_WINDOW, MAX_START_WINDOW);
+                window = MAX_START_WINDOW;
+            }
+
+            if (window > 0 && !device_id_file.empty() && Utils::readFileContent(device_id_file.c_str(), device_id))
+            {
+                Utils::String::trim(device_id);
+            }
+
+            if (window == 0)
+            {
+                /* spreading is disabled */
+            }
+            else if (!device_id.empty())
+            {
+                jitter = startTimeJitter(device_id, window);
+                string saved_jitter = m_setting.contains("StartTimeJitter") ? m_setting.getValue("StartTimeJitter").String() : "";
+                string saved_window = m_setting.contains("StartTimeWindow") ? m_setting.getValue("StartTimeWindow").String() : "";
+                if (saved_jitter != std::to_string(jitter) || saved_window != std::to_string(window))
+                {
+                    m_setting.begin();
+                    m_setting.remove("StartTimeJitter");
+                    m_setting.remove("StartTimeWindow");
+                    m_setting.setValue("StartTimeJitter", std::to_string(jitter));
+                    m_setting.setValue("StartTimeWindow", std::to_string(window));
+                    m_setting.commit();
+                }
+            }
+            else if (m_setting.contains("StartTimeJitter") && m_setting.contains("StartTimeWindow") &&
+                     m_setting.getValue("StartTimeWindow").String() == std::to_string(window))
+            {
+                jitter = (uint32_t)strtoul(m_setting.getValue("StartTimeJitter").String().c_str(), NULL, 10);
+                MM_LOGWARN("No device identifier in %s, using the saved start time offset", device_id_file.c_str());
+            }
+            else
+            {
+                MM_LOGWARN("No device identifier in %s, maintenance starts at the configured time", device_id_file.c_str());
+            }
+
+            if (jitter >= window)
+            {
+                jitter = 0;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                m_start_jitter = jitter;
+                m_start_time_cached = false;
+            }
+            MM_LOGINFO("Maintenance start time offset: %u of %u seconds", jitter, window);
+        }
+
+        /**
+         * @brief Recomputes the maintenance start time and updates the cache.
+         *
+         * The start time is the configured time plus m_start_jitter, taking the
+         * earliest such time still ahead, so an offset pushing today's start
+         * past midnight is not skipped.
+         *
+         * Notifies onMaintenanceStartTimeChanged when a previously cached value
+         * changes, and arms the start time timer to recompute once it passes.
+         *
+         * @return The maintenance start time, -1 if it cannot be computed.
+         */
+        int MaintenanceManager::refreshMaintenanceStartTime()
+        {
+            int start_time;
+            bool changed;
+            {
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                start_time = CalculateStartTime(time(NULL) - (time_t)m_start_jitter);
+                if (start_time > 0)
+                {
+                    start_time += (int)m_start_jitter;
+                }
+                changed = m_start_time_cached && (start_time != m_maintenance_start_time);
+                m_maintenance_start_time = start_time;
+                m_start_time_cached = (m_inotify_fd >= 0);
+
+                if (m_start_timerfd >= 0)
+                {
+                    struct itimerspec its = {};
+                    its.it_value.tv_sec = (start_time > 0) ? start_time : 0;
+                    if (timerfd_settime(m_start_timerfd, TFD_TIMER_ABSTIME | TFD_TIMER_CANCEL_ON_SET, &its, NULL) == -1)
+                    {
+                        MM_LOGERR("timerfd_settime() failed for the maintenance start time: %s", strerror(errno));
+                    }
+                }
+            }
+
+            if (changed)
+            {
+                onMaintenanceStartTimeChanged(start_time);
+            }
+            return start_time;
+        }
+
+        /**
+         * @brief Returns the cached maintenance start time, computing it when the cache is not valid.
+         */
+        int MaintenanceManager::getCachedMaintenanceStartTime()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                if (m_start_time_cached && (m_maintenance_start_time <= 0 || m_maintenance_start_time > time(NULL)))
+                {
+                    return m_maintenance_start_time;
+                }
+            }
+            return refreshMaintenanceStartTime();
+        }
+
+        /**
+         * @brief Starts one maintenance task in the background.
+         *
+         * Arms the task deadline and invokes the task once. Retrying a task that
+         * could not be started is left to the caller, which waits retryDelay()
+         * between attempts and calls failTask() once they are used up.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @return true if the task is running, false otherwise.
+         */
+        bool MaintenanceManager::launchTask(int task_index)
+        {
+            const string &task_name = m_tasks[task_index].command;
+
+            /* an instance still running past its deadline is stopped, not forgotten */
+            if (!reapTask(task_index) && !killTask(task_index))
+            {
+                MM_LOGERR("Previous instance of %s cannot be stopped", task_name.c_str());
+                return false;
+            }
+
+            MM_LOGINFO("Starting Timer for %s", task_name.c_str());
+            if (!task_startTimer(task_index, m_tasks[task_index].timeout))
+            {
+                return false;
+            }
+
+            if (!m_abort_flag)
+            {
+                pid_t pid = -1;
+                m_task_active[task_index] = true;
+                MM_LOGINFO("Starting Task %s", task_name.c_str());
+                recordTaskOutcome(task_index, TASK_OUTCOME_RUNNING);
+                int task_status = 0;
+                int exit_fd = -1;
+                bool in_cgroup = false;
+                Utils::CgroupUsage cgroup_base;
+#if defined(GTEST_ENABLE)
+                if (m_spawn_stub)
+                {
+                    pid = SIMULATED_TASK_PID;
+                    task_status = m_spawn_stub(task_index, exit_fd);
+                }
+                else
+#endif
+                {
+                    /* started inside its cgroup, so nothing it forks runs without the limits */
+                    int cgroup_fd = -1;
+                    {
+                        std::lock_guard<std::mutex> lock(m_processMutex);
+                        if (m_cgroup.isOpen() && (cgroup_fd = m_cgroup.openGroup(m_tasks[task_index].name, cgroupLimits(m_task_background))) < 0)
+                        {
+                            MM_LOGWARN("Failed to open the cgroup of %s, starting it without limits: %s", task_name.c_str(), strerror(errno));
+                        }
+                        m_cgroup.usage(m_tasks[task_index].name, cgroup_base);
+                    }
+                    task_status = Utils::spawnProcess(task_name, pid, cgroup_fd);
+                    in_cgroup = (cgroup_fd >= 0 && task_status == 0);
+                    if (cgroup_fd >= 0)
+                    {
+                        close(cgroup_fd);
+                        if (task_status != 0)
+                        {
+                            MM_LOGWARN("Failed to start %s in its cgroup, trying without limits: %s", task_name.c_str(), strerror(task_status));
+                            task_status = Utils::spawnProcess(task_name, pid);
+                        }
+                    }
+                }
+                if (task_status == 0)
+                {
+                    std::lock_guard<std::mutex> lock(m_processMutex);
+                    TaskProcess &proc = m_task_process[task_index];
+                    proc.pid = pid;
+                    proc.pidfd = (exit_fd >= 0) ? exit_fd : Utils::pidfdOpen(pid);
+                    proc.inCgroup = in_cgroup;
+                    proc.cgroupBase = cgroup_base;
+                    if (proc.pidfd >= 0)
+                    {
+                        struct epoll_event ev = {};
+                        ev.events = EPOLLIN;
+                        ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_PROCESS, task_index);
+                        if (epoll_ctl(m_epoll_fd, EPOLL_CTL_ADD, proc.pidfd, &ev) < 0)
+                        {
+                            MM_LOGERR("Failed to watch %s for exit: %s", task_name.c_str(), strerror(errno));
+                        }
+                    }
+                    MM_LOGINFO("%s started with pid %d", task_name.c_str(), (int)pid);
+                    return true;
+                }
+
+                m_task_active[task_index] = false;
+                MM_LOGINFO("%s invocation failed: %s", task_name.c_str(), strerror(task_status));
+            }
+
+            task_stopTimer(task_index);
+            return false;
+        }
+
+        /**
+         * @brief Sets a task that could not be started to error, releasing its dependents.
+         *
+         * @param task_index Index of the task in m_tasks.
+         */
+        void MaintenanceManager::failTask(int task_index)
+        {
+            MM_LOGINFO("Task Failed");
+            MM_LOGINFO("Setting task as Error");
+            recordTaskOutcome(task_index, TASK_OUTCOME_ERROR);
+            SET_STATUS(g_task_status, m_tasks[task_index].completeBit);
+            /* it may have been the last task of the cycle */
+            requestCycleCheck();
+        }
+
+        /**
+         * @brief Ends the cycle once every task has completed and reports its status.
+         *
+         * Called with m_statusMutex held each time a task completes: from the
+         * event handler, on a task deadline, and through requestCycleCheck()
+         * for a task that could not be started. It joins the maintenance
+         * thread, so the maintenance thread itself must not call it.
+         *
+         * @return true if the cycle has ended.
+         */
+        bool MaintenanceManager::endCycleIfComplete()
+        {
+            if (m_abort_flag || MAINTENANCE_STARTED != m_notify_status)
+            {
+                return false;
+            }
+
+            MM_LOGINFO(" BITFIELD Status : %x", (unsigned int)g_task_status);
+            /* Send the updated status only if all task completes execution
+             * until that we say maintenance started */
+            if ((g_task_status & m_tasks_completed_mask) != m_tasks_completed_mask)
+            {
+                MM_LOGINFO("Tasks are not completed!!!!");
+                return false;
+            }
+
+            Maint_notify_status_t notify_status = MAINTENANCE_STARTED;
+            if ((g_task_status & m_tasks_success_mask) == m_tasks_success_mask)
+            { // all tasks success
+                MM_LOGINFO("Maintenance Successfully Completed!!");
+                notify_status = MAINTENANCE_COMPLETE;
+                /*  we store the time in persistant location */
+                time_t successfulTime = time(nullptr);
+                tm ltime = *localtime(&successfulTime);
+                time_t epoch_time = mktime(&ltime);
+                string str_successfulTime = to_string(epoch_time);
+                MM_LOGINFO("last succesful time is :%s", str_successfulTime.c_str());
+                /* Remove any old completion time */
+                m_setting.begin();
+                m_setting.remove("LastSuccessfulCompletionTime");
+                m_setting.setValue("LastSuccessfulCompletionTime", std::move(str_successfulTime));
+                m_setting.commit();
+            }
+            /* Check other than all success case which means we have errors */
+            else if ((g_task_status & MAINTENANCE_TASK_SKIPPED) == MAINTENANCE_TASK_SKIPPED)
+            {
+                MM_LOGINFO("There are Skipped Task. Maintenance Incomplete");
+                notify_status = MAINTENANCE_INCOMPLETE;
+            }
+            else
+            {
+                MM_LOGINFO("Maintenance Ended with Errors");
+                notify_status = MAINTENANCE_ERROR;
+            }
+
+            MM_LOGINFO("ENDING MAINTENANCE CYCLE");
+            if (m_thread.joinable())
+            {
+                m_thread.join();
+                MM_LOGINFO("Thread joined successfully");
+            }
+
+            if (g_maintenance_type == UNSOLICITED_MAINTENANCE && !g_unsolicited_complete)
+            {
+                g_unsolicited_complete = true;
+            }
+            MaintenanceManager::_instance->onMaintenanceStatusChange(notify_status);
+            return true;
+        }
+
+        /**
+         * @brief Has the task supervisor call endCycleIfComplete().
+         *
+         * For the maintenance thread, which must not wait for m_statusMutex:
+         * the threads that end the cycle join it with the mutex held.
+         */
+        void MaintenanceManager::requestCycleCheck()
+        {
+            uint64_t value = 1;
+            if (m_cycle_fd < 0 || write(m_cycle_fd, &value, sizeof(value)) != sizeof(value))
+            {
+                MM_LOGERR("Failed to have the task supervisor check the cycle: %s", strerror(errno));
+            }
+        }
+
+        /**
+         * @brief Time to wait before the next attempt to start a task.
+         *
+         * The delay doubles with each attempt up to the task's cap. Only its
+         * upper half is random, which keeps devices that failed together from
+         * retrying together without ever retrying much earlier than configured.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param attempt Number of attempts made so far, from 1.
+         */
+        std::chrono::milliseconds MaintenanceManager::retryDelay(int task_index, int attempt) const
+        {
+            static thread_local std::minstd_rand random(std::random_device{}());
+            const Maint_task_definition_t &task = m_tasks[task_index];
+            int64_t delay = (int64_t)task.retryDelay * 1000;
+            for (int i = 1; i < attempt && delay < (int64_t)task.retryDelayMax * 1000; i++)
+            {
+                delay *= 2;
+            }
+            delay = std::min(delay, (int64_t)task.retryDelayMax * 1000);
+            if (delay <= 1)
+            {
+                return std::chrono::milliseconds(delay);
+            }
+            return std::chrono::milliseconds(delay / 2 + (int64_t)(random() % (uint64_t)(delay - delay / 2 + 1)));
+        }
+
+        /**
+         * @brief Resource limits of the task cgroups for a maintenance mode.
+         *
+         * BACKGROUND mode keeps tasks from competing with the UI for CPU and
+         * storage and makes the kernel reclaim their memory early; FOREGROUND
+         * mode restores the kernel defaults.
+         */
+        Utils::CgroupLimits MaintenanceManager::cgroupLimits(bool background) const
+        {
+            if (background)
+            {
+                return Utils::CgroupLimits{ CGROUP_BACKGROUND_CPU_WEIGHT, CGROUP_BACKGROUND_IO_WEIGHT,
+                                            CGROUP_BACKGROUND_MEMORY_HIGH, m_background_io_max };
+            }
+            string io_max;
+            if (!m_background_io_max.empty())
+            {
+                /* lift the throttle of the device configured for BACKGROUND mode */
+                io_max = m_background_io_max.substr(0, m_background_io_max.find(' ')) + " rbps=max wbps=max riops=max wiops=max";
+            }
+            return Utils::CgroupLimits{ CGROUP_FOREGROUND_CPU_WEIGHT, CGROUP_FOREGROUND_IO_WEIGHT, 0, io_max };
+        }
+
+        /**
+         * @brief Switches the limits used for tasks started from now on, and
+         * applies them to the tasks that are running.
+         */
+        void MaintenanceManager::applyTaskLimits(bool background)
+        {
+            std::lock_guard<std::mutex> lock(m_processMutex);
+            m_task_background = background;
+            if (!m_cgroup.isOpen())
+            {
+                return;
+            }
+            for (int task_index = 0; task_index < MAX_MAINTENANCE_TASKS; task_index++)
+            {
+                if (m_task_process[task_index].pid > 0 && !m_cgroup.apply(m_tasks[task_index].name, cgroupLimits(background)))
+                {
+                    MM_LOGWARN("Failed to update the limits of %s: %s", m_tasks[task_index].name.c_str(), strerror(errno));
+                }
+            }
+            MM_LOGINFO("Task limits set for %s mode", background ? "BACKGROUND" : "FOREGROUND");
+        }
+
+        /**
+         * @brief Builds the task registry from the built-in tasks and the configuration.
+         *
+         * An entry of the "tasks" configuration array overrides the built-in task
+         * of the same name; only the fields it sets are changed. The event table
+         * and the completion masks are derived from the result, so an event code
+         * maps to its task with a single lookup.
+         *
+         * @param overrides The "tasks" array of the plugin configuration.
+         */
+        void MaintenanceManager::loadTaskRegistry(const Core::JSON::ArrayType<TaskConfig> &overrides)
+        {
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                m_tasks[i] = default_tasks[i];
+            }
+
+            auto index(overrides.Elements());
+            while (index.Next())
+            {
+                const TaskConfig &entry = index.Current();
+                int task_index = 0;
+                while (task_index < MAX_MAINTENANCE_TASKS && m_tasks[task_index].name != entry.Name.Value())
+                {
+                    task_index++;
+                }
+                if (task_index == MAX_MAINTENANCE_TASKS)
+                {
+                    MM_LOGWARN("Ignoring configuration of unknown task '%s'", entry.Name.Value().c_str());
+                    continue;
+                }
+
+                Maint_task_definition_t &task = m_tasks[task_index];
+                if (entry.Command.IsSet() && !entry.Command.Value().empty())
+                {
+                    /* spawnProcess() splits at whitespace and would pass quotes on as part of an argument */
+                    if (entry.Command.Value().find_first_of("\"'\\") != string::npos)
+                    {
+                        MM_LOGERR("Ignoring command '%s' of task %s: quoting and escaping are not supported", entry.Command.Value().c_str(), task.name.c_str());
+                    }
+                    else
+                    {
+                        task.command = entry.Command.Value();
+                    }
+                }
+                if (entry.Process.IsSet() && !entry.Process.Value().empty())
+                {
+                    task.processName = entry.Process.Value();
+                }
+                if (entry.CompleteEvent.IsSet())
+                {
+                    task.completeEvent = (IARM_Maint_module_status_t)entry.CompleteEvent.Value();
+                }
+                if (entry.ErrorEvent.IsSet())
+                {
+                    task.errorEvent = (IARM_Maint_module_status_t)entry.ErrorEvent.Value();
+                }
+                if (entry.InProgressEvent.IsSet())
+                {
+                    task.inProgressEvent = (IARM_Maint_module_status_t)entry.InProgressEvent.Value();
+                }
+                if (entry.Timeout.IsSet() && entry.Timeout.Value() > 0)
+                {
+                    task.timeout = entry.Timeout.Value();
+                }
+                if (entry.Priority.IsSet())
+                {
+                    task.priority = entry.Priority.Value();
+                }
+                if (entry.Attempts.IsSet() && entry.Attempts.Value() > 0)
+                {
+                    task.attempts = entry.Attempts.Value();
+                }
+                if (entry.RetryDelay.IsSet())
+                {
+                    task.retryDelay = entry.RetryDelay.Value();
+                }
+                if (entry.RetryDelayMax.IsSet())
+                {
+                    task.retryDelayMax = entry.RetryDelayMax.Value();
+                }
+                if (entry.Deferrable.IsSet())
+                {
+                    task.deferrable = entry.Deferrable.Value();
+                }
+                MM_LOGINFO("Task %s: '%s', timeout %d seconds, priority %d, %d attempts, retry delay %d to %d seconds%s",
+                           task.name.c_str(), task.command.c_str(), task.timeout, (int)task.priority,
+                           (int)task.attempts, task.retryDelay, task.retryDelayMax, task.deferrable ? ", deferrable" : "");
+            }
+
+            for (int i = 0; i < MAX_TASK_EVENTS; i++)
+            {
+                m_task_events[i].task = -1;
+                m_task_events[i].kind = TASK_EVENT_NONE;
+            }
+            m_tasks_completed_mask = 0;
+            m_tasks_success_mask = 0;
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                const Maint_task_definition_t &task = m_tasks[i];
+                const struct
+                {
+                    IARM_Maint_module_status_t status;
+                    Maint_task_event_t kind;
+                } events[] = {
+                    {task.completeEvent, TASK_EVENT_COMPLETE},
+                    {task.errorEvent, TASK_EVENT_ERROR},
+                    {task.inProgressEvent, TASK_EVENT_INPROGRESS}};
+                for (const auto &event : events)
+                {
+                    if ((int)event.status < 0 || (int)event.status >= MAX_TASK_EVENTS)
+                    {
+                        MM_LOGWARN("Event %d of task %s is out of range", (int)event.status, task.name.c_str());
+                        continue;
+                    }
+                    m_task_events[event.status].task = i;
+                    m_task_events[event.status].kind = event.kind;
+                }
+                m_tasks_completed_mask |= (1 << task.completeBit);
+                m_tasks_success_mask |= (1 << task.completeBit) | (1 << task.successBit);
+            }
+        }
+
+        /**
+         * @brief Maps a module status to the task it reports on.
+         *
+         * @param status The status received in a maintenance event.
+         * @param task_index Set to the index of the task in m_tasks.
+         * @param kind Set to what the status reports about the task.
+         * @return true if the status belongs to a task, false otherwise.
+         */
+        bool MaintenanceManager::lookupTaskEvent(IARM_Maint_module_status_t status, int &task_index, Maint_task_event_t &kind) const
+        {
+            if ((int)status < 0 || (int)status >= MAX_TASK_EVENTS || m_task_events[status].task < 0)
+            {
+                return false;
+            }
+            task_index = m_task_events[status].task;
+            kind = (Maint_task_event_t)m_task_events[status].kind;
+            return true;
+        }
+
+        /**
+         * @brief Checks whether every task the given task depends on has completed.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @return true if the task may be started, false otherwise.
+         */
+        bool MaintenanceManager::taskDependenciesCompleted(int task_index)
+        {
+            for (int dep = 0; dep < MAX_MAINTENANCE_TASKS; dep++)
+            {
+                if ((m_tasks[task_index].dependencies & (1 << dep)) && !CHECK_STATUS(g_task_status, m_tasks[dep].completeBit))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Checks whether any of the running tasks has reported completion.
+         *
+         * @param running Indices of the tasks that are currently running.
+         * @return true if at least one of them is complete, false otherwise.
+         */
+        bool MaintenanceManager::anyTaskCompleted(const std::vector<int> &running)
+        {
+            for (int task_index : running)
+            {
+                if (CHECK_STATUS(g_task_status, m_tasks[task_index].completeBit))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Checks whether maintenance would compete with the viewer or with sleep.
+         *
+         * The device is in use while it enters or is in deep sleep, and while
+         * media plays unless it is in light standby.
+         */
+        bool MaintenanceManager::deviceInUse() const
+        {
+            switch (m_power_state)
+            {
+                case MAINT_POWER_DEEP_STANDBY:
+                case MAINT_POWER_OFF:
+                    return true;
+                case MAINT_POWER_LIGHT_STANDBY:
+                    return false;
+                default:
+                    return m_playback_active;
+            }
+        }
+
+        /**
+         * @brief Checks whether a task is to be held rather than started now.
+         *
+         * The maintenance thread holds such a task for at most m_max_deferral
+         * seconds per cycle, then starts it anyway.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @return true if the task is deferrable and the device is in use.
+         */
+        bool MaintenanceManager::deferTask(int task_index) const
+        {
+            return m_tasks[task_index].deferrable && m_max_deferral > 0 && deviceInUse();
+        }
+
+        /**
+         * @brief Wakes the maintenance thread to start held tasks once the device is no longer in use.
+         *
+         * Called after m_power_state or m_playback_active has changed.
+         */
+        void MaintenanceManager::onDeviceUseChanged()
+        {
+            if (!deviceInUse())
+            {
+                /* taken so the wakeup cannot fall between the check and the wait */
+                std::lock_guard<std::mutex> lock(m_callMutex);
+                task_thread.notify_all();
+            }
+        }
+
+        /**
+         * @brief Wakes the maintenance thread after a change of the state its wait checks.
+         *
+         * The thread checks that state with m_callMutex held, so taking it here
+         * keeps the wakeup from falling between the check and the wait.
+         */
+        void MaintenanceManager::wakeTaskThread()
+        {
+            std::lock_guard<std::mutex> lock(m_callMutex);
+            task_thread.notify_all();
+        }
+
+        /**
+         * @brief Reaps the process started for a task once it has exited.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param release Stop tracking the process even if it is still running.
+         * @return true if the process has exited or none was tracked, false if it is still running.
+         */
+        bool MaintenanceManager::reapTask(int task_index, bool release)
+        {
+            std::lock_guard<std::mutex> lock(m_processMutex);
+            TaskProcess &proc = m_task_process[task_index];
+            if (proc.pid <= 0)
+            {
+                return true;
+            }
+
+            int status = 0;
+            Utils::ProcessUsage usage;
+            pid_t ret;
+#if defined(GTEST_ENABLE)
+            uint64_t exited = 0;
+            if (proc.pid == SIMULATED_TASK_PID)
+            {
+                ret = (read(proc.pidfd, &exited, sizeof(exited)) == sizeof(exited)) ? proc.pid : 0;
+            }
+            else
+#endif
+            ret = Utils::waitProcess(proc.pid, status, WNOHANG, usage);
+            if (ret == 0 && !release)
+            {
+                return false;
+            }
+            if (ret == proc.pid)
+            {
+                MM_LOGINFO("%s (pid %d) exited with status %d", m_tasks[task_index].command.c_str(), (int)proc.pid, WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+                Utils::CgroupUsage group;
+                if (proc.inCgroup && m_cgroup.usage(m_tasks[task_index].name, group))
+                {
+                    /* the group also counts the processes the task did not wait for */
+                    const Utils::CgroupUsage &base = proc.cgroupBase;
+                    auto since = [](uint64_t now, uint64_t before) { return (now >= before) ? now - before : now; };
+                    usage.cpuUserMs = since(group.cpuUserMs, base.cpuUserMs);
+                    usage.cpuSystemMs = since(group.cpuSystemMs, base.cpuSystemMs);
+                    if (group.hasIo)
+                    {
+                        usage.storageReadBytes = since(group.readBytes, base.readBytes);
+                        usage.storageWriteBytes = since(group.writeBytes, base.writeBytes);
+                    }
+                    usage.memoryPeakKb = group.memoryPeak / 1024;
+                    /* memory.peak cannot be reset; a new group starts it over for the next run */
+                    m_cgroup.remove(m_tasks[task_index].name);
+                }
+                m_task_usage[task_index] = usage;
+                m_task_runs[task_index]++;
+                reportTaskUsage(task_index, usage);
+            }
+            /* ECHILD means the child was already collected, e.g. SIGCHLD is ignored */
+            if (proc.pidfd >= 0)
+            {
+                close(proc.pidfd);
+            }
+            proc.pid = -1;
+            proc.pidfd = -1;
+            proc.inCgroup = false;
+            return (ret != 0);
+        }
+
+        /**
+         * @brief Logs the resources a task used and sends them to telemetry,
+         * one value per resource and task, so that a task whose cost grows
+         * from one release to the next shows up in the fleet data. They are
+         * sent as values of the run rather than as counters, which the
+         * telemetry batch would add up across runs.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param usage What the task and the processes it waited for used,
+         *              or its whole cgroup when it ran in one.
+         */
+        void MaintenanceManager::reportTaskUsage(int task_index, const Utils::ProcessUsage &usage)
+        {
+            const struct
+            {
+                const char *name;
+                uint64_t value;
+                bool known;
+            } values[] = {
+                {"CpuMs", usage.cpuUserMs + usage.cpuSystemMs, true},
+                {"MaxRssKb", usage.maxRssKb, true},
+                {"ReadKb", usage.readBytes / 1024, true},
+                {"WriteKb", usage.writeBytes / 1024, true},
+                {"DiskReadKb", usage.storageReadBytes / 1024, true},
+                {"DiskWriteKb", usage.storageWriteBytes / 1024, true},
+                /* unknown without a cgroup or on kernels without memory.peak */
+                {"PeakMemKb", usage.memoryPeakKb, usage.memoryPeakKb > 0},
+            };
+
+            MM_LOGINFO("%s used cpu %llu+%llu ms, max rss %llu kB, peak memory %llu kB, read %llu/%llu bytes, written %llu/%llu bytes (all/storage)",
+                       m_tasks[task_index].name.c_str(), (unsigned long long)usage.cpuUserMs, (unsigned long long)usage.cpuSystemMs,
+                       (unsigned long long)usage.maxRssKb, (unsigned long long)usage.memoryPeakKb, (unsigned long long)usage.readBytes,
+                       (unsigned long long)usage.storageReadBytes, (unsigned long long)usage.writeBytes, (unsigned long long)usage.storageWriteBytes);
+            for (const auto &entry : values)
+            {
+                if (entry.known)
+                {
+                    string marker = "SYST_INFO_Maint" + m_tasks[task_index].name + "_" + entry.name;
+                    Utils::Telemetry::batcher().message(marker.c_str(), std::to_string(entry.value).c_str());
+                }
+            }
+        }
+
+        /**
+         * @brief Sends a signal to the binary of a task.
+         *
+         * Only the task binary is signalled, so that rdkvfwupgrader and rfcMgr
+         * abort gracefully and the task script around them reports the
+         * result. Tasks started by launchTask() run in their own process
+         * group, which tells their binary apart from one started elsewhere.
+         * When the binary is not running in the group, the group is killed,
+         * as there is nothing left that could abort gracefully. Tasks started
+         * outside the plugin fall back to abortTask().
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param sig Signal for tasks that do not support graceful abort.
+         * @return 0 on success, otherwise an error value.
+         */
+        int MaintenanceManager::signalTask(int task_index, int sig)
+        {
+            pid_t pgid;
+            {
+                std::lock_guard<std::mutex> lock(m_processMutex);
+                pgid = m_task_process[task_index].pid;
+            }
+            if (pgid <= 0)
+            {
+                return abortTask(m_tasks[task_index].processName.c_str(), sig);
+            }
+
+            /* rdkvfwupgrader and rfcMgr abort gracefully on SIGUSR1 */
+#if defined(ENABLE_RFC_MANAGER)
+            if (task_index == TASK_SWUPDATE || task_index == TASK_RFC)
+#else
+            if (task_index == TASK_SWUPDATE)
+#endif
+            {
+                sig = SIGUSR1;
+            }
+
+            const string &name = m_tasks[task_index].processName;
+            pid_t pid = getTaskPID(name.c_str());
+            int k_ret;
+            if (pid > 0 && getpgid(pid) == pgid)
+            {
+                k_ret = (kill(pid, sig) == 0) ? 0 : errno;
+                MM_LOGINFO("%s (pid %d) sent signal %d: %s", name.c_str(), (int)pid, sig, strerror(k_ret));
+            }
+            else
+            {
+                MM_LOGINFO("%s is not running in the group of %s, killing the group", name.c_str(), m_tasks[task_index].command.c_str());
+                k_ret = (killpg(pgid, SIGKILL) == 0) ? 0 : errno;
+                MM_LOGINFO("%s (pgid %d) killed: %s", m_tasks[task_index].command.c_str(), (int)pgid, strerror(k_ret));
+            }
+            return k_ret;
+        }
+
+        /**
+         * @brief Kills a task launched before, with everything in its process group, and reaps it.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @return true if the task is reaped, false if it is still running after TASK_KILL_WAIT_MS.
+         */
+        bool MaintenanceManager::killTask(int task_index)
+        {
+            pid_t pgid;
+            {
+                std::lock_guard<std::mutex> lock(m_processMutex);
+                pgid = m_task_process[task_index].pid;
+            }
+            if (pgid > 0 && killpg(pgid, SIGKILL) != 0)
+            {
+                MM_LOGERR("Failed to kill %s (pgid %d): %s", m_tasks[task_index].command.c_str(), (int)pgid, strerror(errno));
+            }
+            /* SIGKILL cannot be caught, the group leader is gone in a moment */
+            for (int waited = 0; waited < TASK_KILL_WAIT_MS; waited += 10)
+            {
+                if (reapTask(task_index))
+                {
+                    return true;
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            return reapTask(task_index);
+        }
+
+        bool MaintenanceManager::isWhoAmIEnabled()
+        {
+            bool wai_enabled = false;
+            std::string wai_prop_val;
+            if (!Utils::readPropertyFromFile(DEVICE_PROP_FILE, WHOAMI_PROP_KEY, wai_prop_val)) {
+                MM_LOGERR("Failed to read %s property", WHOAMI_PROP_KEY);
+                return wai_enabled;
+            }
+
+            wai_enabled = (wai_prop_val == "true");
+            return wai_enabled;
+        }
+
+        /**
+         * @brief Determines the device identity by querying the Security Manager.
+         *
+         * This function waits for the Security Manager (`org.rdk.SecManager`) to be activated,
+         * unless the device is already activated, and then queries it for the device
+         * initialization context. If the Security Manager provides a valid device initialization context,
+         * it sets this context using the `setDeviceInitializationContext` method.
+         *
+         * @param activation_status A reference to a string containing the current activation status of the device.
+         *                          This status is used to determine if retries are needed.
+         * @return true if the device initialization context was successfully obtained and set, false otherwise.
+         */
+        bool MaintenanceManager::knowWhoAmI(string &activation_status)
         {
             bool success = false;
             const char *secMgr_callsign = "org.rdk.SecManager";
             const char *secMgr_callsign_ver = "org.rdk.SecManager.1";
             PluginHost::IShell::state state;
-            WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement> *thunder_client = nullptr;
+            std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> thunder_client;
 
             do
             {
                 if ((getServiceState(m_service, secMgr_callsign, state) == Core::ERROR_NONE) && (state == PluginHost::IShell::state::ACTIVATED))
                 {
                     MM_LOGINFO("%s is active", secMgr_callsign);
-                    thunder_client = getThunderPluginHandle(secMgr_callsign_ver);
+                    thunder_client = getThunderLink(secMgr_callsign_ver);
                     if (thunder_client != nullptr)
                     {
                         JsonObject params;
                         JsonObject joGetResult;
 
-                        thunder_client->Invoke<JsonObject, JsonObject>(5000, "getDeviceInitializationContext", params, joGetResult);
+                        uint32_t status = thunder_client->Invoke<JsonObject, JsonObject>(5000, "getDeviceInitializationContext", params, joGetResult);
+                        if (isLinkFailure(status))
+                        {
+                            /* The subscription went with the link; renewed below on a new one */
+                            dropThunderLink(secMgr_callsign_ver, status);
+                            g_subscribed_for_deviceContextUpdate = false;
+                        }
                         if (joGetResult.HasLabel("success") && joGetResult["success"].Boolean())
                         {
                             static const char *kDeviceInitializationContext = "deviceInitializationContext";
@@ -649,7 +1997,7 @@ namespace WPEFramework
                         }
 						if (joGetResult.HasLabel("success") && !joGetResult["success"].Boolean())
 						{
-							t2_event_d("SYST_ERROR_WAI_InitERR", 1);
+							Utils::Telemetry::batcher().count("SYST_ERROR_WAI_InitERR");
 						}
                     }
                     else
@@ -666,16 +2014,21 @@ namespace WPEFramework
                 else
                 {
                     g_subscribed_for_deviceContextUpdate = false;
-                    if (activation_status != "activated")
-                    {
-                        MM_LOGINFO("%s is not active. Retry after %d seconds", secMgr_callsign, SECMGR_RETRY_INTERVAL);
-                        std::this_thread::sleep_for(std::chrono::seconds(SECMGR_RETRY_INTERVAL));
-                    }
-                    else
+                    if (activation_status == "activated")
                     {
                         MM_LOGINFO("%s is not active. Device is already Activated. Hence exiting from knoWhoAmI()", secMgr_callsign);
                         return success;
                     }
+                    MM_LOGINFO("%s is not active. Waiting for it to be activated", secMgr_callsign);
+                    while (!waitForPluginActivation(secMgr_callsign, SECMGR_ACTIVATION_TIMEOUT))
+                    {
+                        if (m_abort_flag)
+                        {
+                            MM_LOGINFO("Maintenance stopped while waiting for %s", secMgr_callsign);
+                            return success;
+                        }
+                        MM_LOGINFO("%s is still not active after %d seconds", secMgr_callsign, SECMGR_ACTIVATION_TIMEOUT);
+                    }
                 }
             } while (true);
         }
@@ -723,180 +2076,411 @@ namespace WPEFramework
         }
 
         /**
-         * @brief Creates a new task timer.
+         * @brief Returns the pooled JSON-RPC link to a Thunder plugin, creating it on first use.
          *
-         * This function initializes and creates a new task timer if it does not already exist or is not running.
+         * Links stay open for the lifetime of the plugin, so calls and event
+         * subscriptions on the same callsign share one websocket. A link that
+         * failed is dropped by dropThunderLink() and recreated on the next call.
          *
-         * @return true if the timer was successfully created, false otherwise.
+         * @param callsign The versioned callsign of the Thunder plugin.
+         * @return A shared JSONRPC link for the specified plugin.
          */
-        bool MaintenanceManager::maintenance_initTimer()
+        std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> MaintenanceManager::getThunderLink(const string &callsign)
         {
-            if (g_task_timerCreated)
+            std::lock_guard<std::mutex> lock(m_linkMutex);
+            auto it = m_thunder_links.find(callsign);
+            if (it != m_thunder_links.end())
             {
-                MM_LOGINFO("Timer has already been created, no need to create a Timer.");
-                return g_task_timerCreated;
+                m_link_reuses++;
+                return it->second;
             }
 
-            struct sigevent sev = {0};
-            sev.sigev_notify = SIGEV_SIGNAL;
-            sev.sigev_signo = SIGALRM;
-            sev.sigev_value.sival_ptr = &timerid;
-
-            if (timer_create(BASE_CLOCK, &sev, &timerid) == -1)
+            std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> thunder_client(getThunderPluginHandle(callsign.c_str()));
+            if (thunder_client != nullptr)
             {
-                MM_LOGERR("timer_create() failed to create the Timer");
+                m_thunder_links[callsign] = thunder_client;
+                m_link_creations++;
+                MM_LOGINFO("Created JSON-RPC link to %s (%u created, %u reused)", callsign.c_str(), m_link_creations, m_link_reuses);
             }
-            else
+            return thunder_client;
+        }
+
+        /**
+         * @brief Drops a pooled link after a transport failure so the next call reconnects.
+         *
+         * @param callsign The versioned callsign the link was created for.
+         * @param status The error returned by the failed call.
+         */
+        void MaintenanceManager::dropThunderLink(const string &callsign, uint32_t status)
+        {
+            std::lock_guard<std::mutex> lock(m_linkMutex);
+            if (m_thunder_links.erase(callsign) > 0)
             {
-                g_task_timerCreated = true; // Timer Created
-                MM_LOGINFO("Timer created successfully.");
+                MM_LOGWARN("Dropped JSON-RPC link to %s after error %u", callsign.c_str(), status);
             }
-            return g_task_timerCreated;
         }
 
         /**
-         * @brief Starts or restarts the task timer.
+         * @brief Starts the task supervisor.
          *
-         * This function starts or restarts the task timer with a predefined timeout.
+         * The supervisor thread waits through epoll on a timerfd per task for
+         * its deadline, on the pidfd of each launched task for its exit, on an
+         * eventfd used to stop it, and on one the maintenance thread uses to
+         * have the end of a cycle checked. Nothing runs in signal context.
          *
-         * @return true if the timer was successfully started, false otherwise.
+         * It also keeps the cached maintenance start time current, through an
+         * inotify watch on the files it is computed from and a timerfd that
+         * fires when the cached time passes or the wall clock is set, and the
+         * index of task PIDs current through process connector events.
+         *
+         * @return true if the supervisor is running, false otherwise.
          */
-        bool MaintenanceManager::task_startTimer()
+        bool MaintenanceManager::startTaskSupervisor()
         {
-            bool status = false;
-            if (g_task_timerCreated)
+            if (m_epoll_fd >= 0)
+            {
+                return true;
+            }
+
+            int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+            if (epoll_fd < 0)
+            {
+                MM_LOGERR("epoll_create1() failed: %s", strerror(errno));
+                return false;
+            }
+
+            bool success = true;
+            struct epoll_event ev = {};
+            m_wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            ev.events = EPOLLIN;
+            ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_WAKEUP, 0);
+            if (m_wakeup_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, m_wakeup_fd, &ev) < 0)
             {
-                MM_LOGINFO("Timer has already been created, start the Timer");
+                success = false;
             }
-            else
+            m_cycle_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+            ev.events = EPOLLIN;
+            ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_CYCLE, 0);
+            if (success && (m_cycle_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, m_cycle_fd, &ev) < 0))
             {
-                MM_LOGINFO("Timer has not been created already, create a new Timer.");
-                if (!maintenance_initTimer())
+                success = false;
+            }
+            for (int i = 0; success && i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                m_task_timerfd[i] = timerfd_create(BASE_CLOCK, TFD_CLOEXEC | TFD_NONBLOCK);
+                ev.events = EPOLLIN;
+                ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_TIMER, i);
+                if (m_task_timerfd[i] < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, m_task_timerfd[i], &ev) < 0)
                 {
-                    return status;
+                    success = false;
                 }
             }
 
-            struct itimerspec its;
-            its.it_value.tv_sec = TASK_TIMEOUT;
-            its.it_value.tv_nsec = 0;
-            its.it_interval.tv_sec = 0;
-            its.it_interval.tv_nsec = 0;
+            {
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                m_start_timerfd = timerfd_create(CLOCK_REALTIME, TFD_CLOEXEC | TFD_NONBLOCK);
+            }
+            ev.events = EPOLLIN;
+            ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_START_TIME, 0);
+            if (success && (m_start_timerfd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, m_start_timerfd, &ev) < 0))
+            {
+                success = false;
+            }
 
-            if (timer_settime(timerid, 0, &its, NULL) == -1)
+            /* Without a watch on every file the start time is simply not cached */
+            int inotify_fd = inotify_init1(IN_CLOEXEC | IN_NONBLOCK);
+            bool watching = (inotify_fd >= 0);
+            for (size_t i = 0; watching && i < sizeof(start_time_files) / sizeof(start_time_files[0]); i++)
+            {
+                if (inotify_add_watch(inotify_fd, start_time_files[i][0], IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE) < 0)
+                {
+                    watching = false;
+                }
+            }
+            ev.events = EPOLLIN;
+            ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_FILES, 0);
+            if (watching && epoll_ctl(epoll_fd, EPOLL_CTL_ADD, inotify_fd, &ev) == 0)
             {
-                MM_LOGERR("timer_settime() failed to start the Timer");
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                m_inotify_fd = inotify_fd;
             }
             else
             {
-                MM_LOGINFO("Timer started for %d seconds for %s", TASK_TIMEOUT, currentTask.c_str());
-                status = true;
+                MM_LOGWARN("Cannot watch the maintenance start time files, it will not be cached: %s", strerror(errno));
+                if (inotify_fd >= 0)
+                {
+                    close(inotify_fd);
+                }
+            }
+
+            /* Without process events getTaskPID() scans /proc on every call */
+            int proc_events_fd = m_process_index.open();
+            ev.events = EPOLLIN;
+            ev.data.u64 = SUPERVISOR_EVENT(SUPERVISOR_PROC_EVENTS, 0);
+            if (proc_events_fd < 0 || epoll_ctl(epoll_fd, EPOLL_CTL_ADD, proc_events_fd, &ev) < 0)
+            {
+                MM_LOGWARN("Process events are not available, task PIDs will be looked up in %s", "/proc");
+                m_process_index.close();
             }
-            return status;
+
+            m_epoll_fd = epoll_fd;
+            if (!success)
+            {
+                MM_LOGERR("Failed to set up the task supervisor: %s", strerror(errno));
+                stopTaskSupervisor();
+                return false;
+            }
+
+            try
+            {
+                m_supervisor_thread = std::thread(&MaintenanceManager::task_supervisor_thread, this);
+            }
+            catch (const std::system_error &e)
+            {
+                MM_LOGERR("Failed to start the task supervisor: %s", e.what());
+                stopTaskSupervisor();
+                return false;
+            }
+            MM_LOGINFO("Task supervisor started");
+            return true;
         }
 
         /**
-         * @brief Stops the task timer.
-         *
-         * This function stops the task timer if it is currently running.
-         *
-         * @return true if the timer was successfully stopped, false otherwise.
+         * @brief Stops the task supervisor and releases its descriptors.
          */
-        bool MaintenanceManager::task_stopTimer()
+        void MaintenanceManager::stopTaskSupervisor()
         {
-            bool status = false;
-            if (!g_task_timerCreated)
+            if (m_supervisor_thread.joinable())
+            {
+                uint64_t value = 1;
+                if (write(m_wakeup_fd, &value, sizeof(value)) != sizeof(value))
+                {
+                    MM_LOGERR("Failed to wake up the task supervisor: %s", strerror(errno));
+                }
+                m_supervisor_thread.join();
+                MM_LOGINFO("Task supervisor stopped");
+            }
+
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                if (m_task_timerfd[i] >= 0)
+                {
+                    close(m_task_timerfd[i]);
+                    m_task_timerfd[i] = -1;
+                }
+            }
+            if (m_wakeup_fd >= 0)
+            {
+                close(m_wakeup_fd);
+                m_wakeup_fd = -1;
+            }
+            if (m_cycle_fd >= 0)
+            {
+                close(m_cycle_fd);
+                m_cycle_fd = -1;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_startTimeMutex);
+                if (m_start_timerfd >= 0)
+                {
+                    close(m_start_timerfd);
+                    m_start_timerfd = -1;
+                }
+                if (m_inotify_fd >= 0)
+                {
+                    close(m_inotify_fd);
+                    m_inotify_fd = -1;
+                }
+                m_start_time_cached = false;
+            }
+            m_process_index.close();
+            if (m_epoll_fd >= 0)
             {
-                MM_LOGINFO("Timer has not been created already, cannot stop the Timer");
-                return status;
+                close(m_epoll_fd);
+                m_epoll_fd = -1;
             }
+        }
+
+        /**
+         * @brief Task supervisor loop, dispatching task deadlines and exits.
+         */
+        void MaintenanceManager::task_supervisor_thread()
+        {
+            struct epoll_event events[MAX_MAINTENANCE_TASKS * 2 + 5];
+            bool running = true;
+
+            while (running)
+            {
+                int count = epoll_wait(m_epoll_fd, events, sizeof(events) / sizeof(events[0]), -1);
+                if (count < 0)
+                {
+                    if (errno == EINTR)
+                    {
+                        continue;
+                    }
+                    MM_LOGERR("epoll_wait() failed: %s", strerror(errno));
+                    break;
+                }
 
-            struct itimerspec its = {0};
-            its.it_value.tv_sec = 0;
-            its.it_value.tv_nsec = 0;
+                for (int n = 0; n < count; n++)
+                {
+                    int task_index = (int)(events[n].data.u64 & 0xFFFFFFFF);
+                    uint64_t expirations = 0;
+
+                    switch (events[n].data.u64 >> 32)
+                    {
+                    case SUPERVISOR_WAKEUP:
+                        running = false;
+                        break;
+                    case SUPERVISOR_TIMER:
+                        /* A timer re-armed after it fired has nothing to read */
+                        if (read(m_task_timerfd[task_index], &expirations, sizeof(expirations)) == sizeof(expirations))
+                        {
+                            onTaskTimeout(task_index);
+                        }
+                        break;
+                    case SUPERVISOR_PROCESS:
+                        onTaskExit(task_index);
+                        break;
+                    case SUPERVISOR_FILES:
+                        if (startTimeFilesChanged())
+                        {
+                            refreshMaintenanceStartTime();
+                        }
+                        break;
+                    case SUPERVISOR_START_TIME:
+                        /* expired, or ECANCELED because the wall clock was set */
+                        if (read(m_start_timerfd, &expirations, sizeof(expirations)) == sizeof(expirations) || errno == ECANCELED)
+                        {
+                            refreshMaintenanceStartTime();
+                        }
+                        break;
+                    case SUPERVISOR_PROC_EVENTS:
+                        m_process_index.dispatch();
+                        break;
+                    case SUPERVISOR_CYCLE:
+                        if (read(m_cycle_fd, &expirations, sizeof(expirations)) == sizeof(expirations))
+                        {
+                            std::lock_guard<std::mutex> lock(m_statusMutex);
+                            endCycleIfComplete();
+                        }
+                        break;
+                    }
+                }
+            }
+        }
 
-            if (timer_settime(timerid, 0, &its, NULL) == -1)
+        /**
+         * @brief Arms the deadline of a task.
+         *
+         * @param task_index Index of the task in m_tasks.
+         * @param timeout Seconds the task may run before it is set to error.
+         * @return true if the deadline was armed, false otherwise.
+         */
+        bool MaintenanceManager::task_startTimer(int task_index, int timeout)
+        {
+            if (!startTaskSupervisor())
             {
-                MM_LOGERR("timer_settime() failed to stop the Timer");
+                return false;
             }
-            else
+
+            struct itimerspec its = {};
+            its.it_value.tv_sec = timeout;
+
+            if (timerfd_settime(m_task_timerfd[task_index], 0, &its, NULL) == -1)
             {
-                MM_LOGINFO("Timer stopped for %s", currentTask.c_str());
-                status = true;
+                MM_LOGERR("timerfd_settime() failed to start the Timer for %s", m_tasks[task_index].command.c_str());
+                return false;
             }
-            return status;
+            MM_LOGINFO("Timer started for %d seconds for %s", timeout, m_tasks[task_index].command.c_str());
+            return true;
         }
 
         /**
-         * @brief Deletes the task timer.
+         * @brief Disarms the deadline of a task.
          *
-         * This function deletes the task timer, stopping it first if necessary.
+         * @param task_index Index of the task in m_tasks.
+         * @return true if the deadline was disarmed, false if the supervisor is not running.
+         */
+        bool MaintenanceManager::task_stopTimer(int task_index)
+        {
+            if (m_task_timerfd[task_index] < 0)
+            {
+                MM_LOGINFO("Task supervisor is not running, cannot stop the Timer");
+                return false;
+            }
+
+            struct itimerspec its = {};
+            if (timerfd_settime(m_task_timerfd[task_index], 0, &its, NULL) == -1)
+            {
+                MM_LOGERR("timerfd_settime() failed to stop the Timer for %s", m_tasks[task_index].command.c_str());
+                return false;
+            }
+            MM_LOGINFO("Timer stopped for %s", m_tasks[task_index].command.c_str());
+            return true;
+        }
+
+        /**
+         * @brief Disarms the deadlines of all tasks.
          *
-         * @return true if the timer was successfully deleted, false otherwise.
+         * @return true if every deadline was disarmed, false otherwise.
          */
-        bool MaintenanceManager::maintenance_deleteTimer()
+        bool MaintenanceManager::task_stopAllTimers()
         {
-            bool status = false;
-            if (!g_task_timerCreated)
+            bool status = true;
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
             {
-                MM_LOGINFO("Timer has not been created already, cannot delete the Timer.");
-                return status;
+                status = task_stopTimer(i) && status;
             }
+            return status;
+        }
 
-            MM_LOGINFO("Timer has already been created, delete the Timer.");
+        /**
+         * @brief Handles the expiry of a task deadline by setting the task to error.
+         *
+         * @param task_index Index of the task in m_tasks.
+         */
+        void MaintenanceManager::onTaskTimeout(int task_index)
+        {
+            const string &failedTask = m_tasks[task_index].command;
+            MM_LOGERR("Timeout reached for %s. Set task to Error...", failedTask.c_str());
 
-            if (timer_delete(timerid) == -1)
+            std::lock_guard<std::mutex> lock(m_statusMutex);
+            if (!m_task_active[task_index])
             {
-                MM_LOGERR("timer_delete() failed to delete the Timer.");
+                MM_LOGINFO("Ignoring Error Event for Task: %s", failedTask.c_str());
             }
             else
             {
-                g_task_timerCreated = false;
-                MM_LOGINFO("Timer successfully deleted.");
-                status = true;
+                m_task_active[task_index] = false;
+                recordTaskOutcome(task_index, TASK_OUTCOME_TIMEOUT);
+                SET_STATUS(g_task_status, m_tasks[task_index].completeBit);
+                wakeTaskThread();
+                MM_LOGINFO("Set %s Task to ERROR", failedTask.c_str());
+                endCycleIfComplete();
             }
-            return status;
         }
 
         /**
-         * @brief Handles the timer signal.
+         * @brief Handles the exit of a launched task.
          *
-         * This function is invoked when the task timer expires and processes the timeout accordingly.
+         * The process is reaped right away. A task that exits without having
+         * reported completion gets TASK_EXIT_GRACE seconds for its event to
+         * arrive before it is set to error.
          *
-         * @param signo The signal number received.
+         * @param task_index Index of the task in m_tasks.
          */
-        void MaintenanceManager::timer_handler(int signo)
+        void MaintenanceManager::onTaskExit(int task_index)
         {
-            if (signo == SIGALRM)
+            /* reapTask() also ignores a stale event for a task relaunched meanwhile */
+            if (!reapTask(task_index))
             {
-                MM_LOGERR("Timeout reached for %s. Set task to Error...", currentTask.c_str());
-
-                const char *failedTask = nullptr;
-                int complete_status = 0;
-                for (size_t j = 0; j < (sizeof(task_names_foreground) / sizeof(task_names_foreground[0])); j++)
-                {
-                    if (currentTask.find(task_names_foreground[j]) != string::npos)
-                    {
-                        failedTask = task_names_foreground[j].c_str();
-                        complete_status = task_complete_status[j];
-                        break;
-                    }
-                }
-                if (failedTask && !MaintenanceManager::_instance->m_task_map[failedTask])
-                {
-                    MM_LOGINFO("Ignoring Error Event for Task: %s", failedTask);
-                }
-                else if (failedTask)
-                {
-                    MaintenanceManager::_instance->m_task_map[failedTask] = false;
-                    SET_STATUS(MaintenanceManager::_instance->g_task_status, complete_status);
-                    MaintenanceManager::_instance->task_thread.notify_one();
-                    MM_LOGINFO("Set %s Task to ERROR", failedTask);
-                }
+                return;
             }
-            else
+            if (!CHECK_STATUS(g_task_status, m_tasks[task_index].completeBit))
             {
-                MM_LOGERR("Received %d Signal instead of SIGALRM", signo);
+                MM_LOGINFO("%s exited without reporting completion", m_tasks[task_index].command.c_str());
+                task_startTimer(task_index, TASK_EXIT_GRACE);
             }
         }
 
@@ -972,9 +2556,9 @@ namespace WPEFramework
             bool result = false;
             MM_LOGINFO("Attempting to subscribe for %s events", event.c_str());
             const char *network_callsign = "org.rdk.Network.1";
-            WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement> *thunder_client = nullptr;
+            std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> thunder_client;
 
-            thunder_client = getThunderPluginHandle(network_callsign);
+            thunder_client = getThunderLink(network_callsign);
             if (thunder_client == nullptr)
             {
                 MM_LOGERR("Failed to get plugin handle");
@@ -1006,20 +2590,116 @@ namespace WPEFramework
 
             if (parameters.HasLabel("status") && parameters.HasLabel("state"))
             {
-                value = parameters["status"].String();
-                state = parameters["state"].Number();
+                value = parameters["status"].String();
+                state = parameters["state"].Number();
+
+                MM_LOGINFO("Received onInternetStatusChange event: [%s:%d]", value.c_str(), state);
+                setInternetState(state);
+                if (g_listen_to_nwevents)
+                {
+
+                    if (state == INTERNET_CONNECTED_STATE)
+                    {
+                        startCriticalTasks();
+                        g_listen_to_nwevents = false;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Records the last known internet state and wakes up isDeviceOnline().
+         *
+         * @param state The onInternetStatusChange state, INTERNET_UNKNOWN_STATE if not known.
+         */
+        void MaintenanceManager::setInternetState(int state)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_networkMutex);
+                m_internet_state = state;
+            }
+            m_network_cv.notify_all();
+        }
+
+        /**
+         * @brief Records a plugin activation reported by m_pluginStateSink and wakes up waitForPluginActivation().
+         *
+         * @param callsign The callsign of the plugin whose state changed.
+         * @param activated true if the plugin is now activated, false otherwise.
+         */
+        void MaintenanceManager::onPluginStateChange(const string &callsign, bool activated)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_pluginStateMutex);
+                auto it = m_plugin_activated.find(callsign);
+                if (it == m_plugin_activated.end())
+                {
+                    /* Only plugins someone waits for are tracked */
+                    return;
+                }
+                it->second = activated;
+            }
+            MM_LOGINFO("%s is %s", callsign.c_str(), activated ? "activated" : "no longer activated");
+            m_pluginState_cv.notify_all();
+        }
+
+        /**
+         * @brief Waits until a plugin is activated.
+         *
+         * The plugin state is queried once; after that the wait ends as soon as
+         * m_pluginStateSink reports the plugin activated, or maintenance is
+         * stopped. If the sink could not be registered, the state is queried
+         * again every PLUGIN_STATE_POLL_INTERVAL seconds instead.
+         *
+         * @param callsign The callsign of the plugin.
+         * @param timeout Seconds to wait for the plugin.
+         * @return true if the plugin is activated, false otherwise.
+         */
+        bool MaintenanceManager::waitForPluginActivation(const string &callsign, int timeout)
+        {
+            PluginHost::IShell::state state = PluginHost::IShell::state::UNAVAILABLE;
+            {
+                /* Only a notification from here on ends the wait below */
+                std::lock_guard<std::mutex> lock(m_pluginStateMutex);
+                m_plugin_activated[callsign] = false;
+            }
+            if ((getServiceState(m_service, callsign, state) == Core::ERROR_NONE) && (state == PluginHost::IShell::state::ACTIVATED))
+            {
+                return true;
+            }
 
-                MM_LOGINFO("Received onInternetStatusChange event: [%s:%d]", value.c_str(), state);
-                if (g_listen_to_nwevents)
+            auto start = std::chrono::steady_clock::now();
+            auto deadline = start + std::chrono::seconds(timeout);
+            std::unique_lock<std::mutex> lock(m_pluginStateMutex);
+            while (!m_abort_flag)
+            {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline)
                 {
-
-                    if (state == INTERNET_CONNECTED_STATE)
+                    break;
+                }
+                auto wake = m_pluginStateRegistered ? deadline : std::min(deadline, now + std::chrono::seconds(PLUGIN_STATE_POLL_INTERVAL));
+                if (m_pluginState_cv.wait_until(lock, wake, [this, &callsign] { return m_abort_flag || m_plugin_activated[callsign]; }))
+                {
+                    if (m_abort_flag)
                     {
-                        startCriticalTasks();
-                        g_listen_to_nwevents = false;
+                        break;
+                    }
+                    MM_LOGINFO("%s activated after %d ms", callsign.c_str(), (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+                    return true;
+                }
+                if (!m_pluginStateRegistered && std::chrono::steady_clock::now() < deadline)
+                {
+                    lock.unlock();
+                    bool activated = (getServiceState(m_service, callsign, state) == Core::ERROR_NONE) && (state == PluginHost::IShell::state::ACTIVATED);
+                    lock.lock();
+                    if (activated)
+                    {
+                        return true;
                     }
                 }
             }
+            return false;
         }
 
         /**
@@ -1043,8 +2723,12 @@ namespace WPEFramework
                     if (contextSet)
                     {
                         MM_LOGINFO("setDeviceInitializationContext() success");
-                        g_listen_to_deviceContextUpdate = false;
                         MM_LOGINFO("Notify maintenance execution thread");
+                        {
+                            /* the maintenance thread checks the flag with m_waiMutex held */
+                            std::lock_guard<std::mutex> lock(m_waiMutex);
+                            g_listen_to_deviceContextUpdate = false;
+                        }
                         task_thread.notify_one();
                     }
                     else
@@ -1132,44 +2816,15 @@ namespace WPEFramework
         {
             JsonObject joGetParams;
             JsonObject joGetResult;
-            std::string callsign = "org.rdk.AuthService.1";
-            uint8_t i = 0;
             std::string ret_status("invalid");
 
             /* check if plugin active */
-            PluginHost::IShell::state state = PluginHost::IShell::state::UNAVAILABLE;
-            if ((getServiceState(m_service, "org.rdk.AuthService", state) != Core::ERROR_NONE) || (state != PluginHost::IShell::state::ACTIVATED))
-            {
-                MM_LOGERR("AuthService plugin is not activated.Retrying");
-                // if plugin is not activated we need to retry
-                do
-                {
-                    if ((getServiceState(m_service, "org.rdk.AuthService", state) != Core::ERROR_NONE) || (state != PluginHost::IShell::state::ACTIVATED))
-                    {
-                        sleep(10);
-                        i++;
-                        MM_LOGINFO("AuthService retries [%d/4]", i);
-                    }
-                    else
-                    {
-                        break;
-                    }
-                } while (i < MAX_ACTIVATION_RETRIES);
-
-                if (state != PluginHost::IShell::state::ACTIVATED)
-                {
-                    MM_LOGERR("AuthService plugin is Still not active");
-                    return ret_status;
-                }
-                else
-                {
-                    MM_LOGINFO("AuthService plugin is Now active");
-                }
-            }
-            if (state == PluginHost::IShell::state::ACTIVATED)
+            if (!waitForPluginActivation("org.rdk.AuthService", AUTHSERVICE_ACTIVATION_TIMEOUT))
             {
-                MM_LOGINFO("AuthService is active");
+                MM_LOGERR("AuthService plugin is Still not active");
+                return ret_status;
             }
+            MM_LOGINFO("AuthService is active");
 
             if (!queryIAuthService())
             {
@@ -1272,13 +2927,12 @@ namespace WPEFramework
             std::string callsign = "org.rdk.Network.1";
             PluginHost::IShell::state state;
 
-            string token;
-
             if ((getServiceState(m_service, "org.rdk.Network", state) == Core::ERROR_NONE) && (state == PluginHost::IShell::state::ACTIVATED))
             {
                 MM_LOGINFO("Network plugin is active");
 
-                if (UNSOLICITED_MAINTENANCE == g_maintenance_type && !g_subscribed_for_nwevents)
+                /* Also lets isDeviceOnline() wait for connectivity instead of polling */
+                if (!g_subscribed_for_nwevents)
                 {
                     // Subscribe for internetConnectionStatusChange event
                     bool subscribe_status = subscribeForInternetStatusEvent("onInternetStatusChange");
@@ -1300,37 +2954,19 @@ namespace WPEFramework
             }
 
             // TODO: use interfaces and remove token
-            auto security = m_service->QueryInterfaceByCallsign<PluginHost::IAuthenticate>("SecurityAgent");
-            if (security != nullptr)
-            {
-                string payload = "http://localhost";
-                if (security->CreateToken(
-                        static_cast<uint16_t>(payload.length()),
-                        reinterpret_cast<const uint8_t *>(payload.c_str()),
-                        token) == Core::ERROR_NONE)
-                {
-                    MM_LOGINFO("MaintenanceManager got security token");
-                }
-                else
-                {
-                    MM_LOGERR("MaintenanceManager failed to get security token");
-                }
-                security->Release();
-            }
-            else
-            {
-                MM_LOGERR("No security agent");
-            }
-
-            string query = "token=" + token;
-            Core::SystemInfo::SetEnvironment(_T("THUNDER_ACCESS"), _T(SERVER_DETAILS));
-            auto thunder_client = make_shared<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>>(callsign.c_str(), "", false, query);
+            auto thunder_client = getThunderLink(callsign);
             if (thunder_client != nullptr)
             {
                 uint32_t status = thunder_client->Invoke<JsonObject, JsonObject>(5000, "isConnectedToInternet", joGetParams, joGetResult);
                 if (status > 0)
                 {
                     MM_LOGINFO("%s call failed %d", callsign.c_str(), status);
+                    if (isLinkFailure(status))
+                    {
+                        /* The subscription went with the link; renewed on the next check */
+                        dropThunderLink(callsign, status);
+                        g_subscribed_for_nwevents = false;
+                    }
 #if defined(GTEST_ENABLE)
                     return true;
 #else
@@ -1339,8 +2975,13 @@ namespace WPEFramework
                 }
                 else if (joGetResult.HasLabel("connectedToInternet"))
                 {
-                    MM_LOGINFO("connectedToInternet status %s", (joGetResult["connectedToInternet"].Boolean()) ? "true" : "false");
-                    return joGetResult["connectedToInternet"].Boolean();
+                    bool connected = joGetResult["connectedToInternet"].Boolean();
+                    MM_LOGINFO("connectedToInternet status %s", (connected) ? "true" : "false");
+                    if (connected)
+                    {
+                        setInternetState(INTERNET_CONNECTED_STATE);
+                    }
+                    return connected;
                 }
                 else
                 {
@@ -1353,36 +2994,72 @@ namespace WPEFramework
         }
 
         /**
-         * @brief Checks if the device is online.
+         * @brief Checks if the device is online, waiting for it to come online.
          *
-         * This function checks the network connection status with retries.
+         * A connected state reported by onInternetStatusChange is trusted while
+         * subscribed, so no isConnectedToInternet call is made. Otherwise the
+         * network plugin is asked once, and the call then blocks until the event
+         * reports the device connected, the timeout passes or maintenance is
+         * stopped. Without a subscription the plugin is asked again every
+         * NETWORK_RETRY_INTERVAL seconds.
          *
+         * @param timeout Seconds to wait for connectivity.
          * @return true if the device is online, false otherwise.
          */
-        bool MaintenanceManager::isDeviceOnline()
+        bool MaintenanceManager::isDeviceOnline(int timeout)
         {
-            bool network_available = false;
             MM_LOGINFO("Checking device has network connectivity");
-            /* add 4 checks every 30 seconds */
-            network_available = checkNetwork();
-#if !defined(GTEST_ENABLE)
-            if (!network_available)
             {
-                int retry_count = 0;
-                while (retry_count < MAX_NETWORK_RETRIES)
+                std::lock_guard<std::mutex> lock(m_networkMutex);
+                if (g_subscribed_for_nwevents && m_internet_state == INTERNET_CONNECTED_STATE)
                 {
-                    MM_LOGINFO("Network not available. Sleeping for %d seconds", NETWORK_RETRY_INTERVAL);
-                    sleep(NETWORK_RETRY_INTERVAL);
-                    MM_LOGINFO("Network retries [%d/%d]", ++retry_count, MAX_NETWORK_RETRIES);
-                    network_available = checkNetwork();
-                    if (network_available)
+                    MM_LOGINFO("Device is online as per the last onInternetStatusChange event");
+                    return true;
+                }
+                /* Only a state reported from here on ends the wait below */
+                m_internet_state = INTERNET_UNKNOWN_STATE;
+            }
+
+            if (checkNetwork())
+            {
+                return true;
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            auto deadline = start + std::chrono::seconds(timeout);
+            std::unique_lock<std::mutex> lock(m_networkMutex);
+            while (!m_abort_flag)
+            {
+                auto now = std::chrono::steady_clock::now();
+                if (now >= deadline)
+                {
+                    break;
+                }
+                auto wake = g_subscribed_for_nwevents ? deadline : std::min(deadline, now + std::chrono::seconds(NETWORK_RETRY_INTERVAL));
+                MM_LOGINFO("Network not available. Waiting up to %d seconds", (int)std::chrono::duration_cast<std::chrono::seconds>(wake - now).count());
+                if (m_network_cv.wait_until(lock, wake, [this] { return m_abort_flag || m_internet_state == INTERNET_CONNECTED_STATE; }))
+                {
+                    if (m_abort_flag)
                     {
                         break;
                     }
+                    MM_LOGINFO("Device came online after %d ms", (int)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+                    return true;
+                }
+                if (!g_subscribed_for_nwevents && std::chrono::steady_clock::now() < deadline)
+                {
+                    /* checkNetwork() may subscribe, and updates m_internet_state itself */
+                    lock.unlock();
+                    bool network_available = checkNetwork();
+                    lock.lock();
+                    if (network_available)
+                    {
+                        return true;
+                    }
                 }
             }
-#endif
-            return network_available;
+            MM_LOGINFO("Network not available%s", m_abort_flag ? ", maintenance stopped" : "");
+            return false;
         }
 
         /**
@@ -1448,12 +3125,12 @@ namespace WPEFramework
             bool result = false;
             string event = "onDeviceInitializationContextUpdate";
             const char *secMgr_callsign_ver = "org.rdk.SecManager.1";
-            WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement> *thunder_client = nullptr;
+            std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> thunder_client;
 
             // subscribe to onDeviceInitializationContextUpdate event
             MM_LOGINFO("Attempting to subscribe for %s events", event.c_str());
 
-            thunder_client = getThunderPluginHandle(secMgr_callsign_ver);
+            thunder_client = getThunderLink(secMgr_callsign_ver);
             if (thunder_client == nullptr)
             {
                 MM_LOGINFO("Failed to get plugin handle");
@@ -1481,8 +3158,99 @@ namespace WPEFramework
             }
         }
 
+        /**
+         * @brief Registers for the power mode notifications of org.rdk.PowerManager and reads the current mode.
+         *
+         * Deferrable tasks are held while the device enters or is in deep sleep;
+         * without the notifications the power state stays unknown and only
+         * setPlaybackState holds them.
+         *
+         * @return true if the registration was successful, false otherwise.
+         */
+        bool MaintenanceManager::subscribeToPowerStateEvents()
+        {
+            MM_LOGINFO("Attempting to register for %s power mode notifications", POWER_MANAGER_CALLSIGN);
+            if (!m_powerManager)
+            {
+                m_powerManager = PowerManagerInterfaceBuilder(_T(POWER_MANAGER_CALLSIGN))
+                                     .withIShell(m_service)
+                                     .createInterface();
+            }
+            if (!m_powerManager)
+            {
+                MM_LOGINFO("Failed to get the %s interface", POWER_MANAGER_CALLSIGN);
+                return false;
+            }
+
+            uint32_t status = m_powerManager->Register(static_cast<Exchange::IPowerManager::IModeChangedNotification *>(&m_powerModeSink));
+            if (status == Core::ERROR_NONE)
+            {
+                status = m_powerManager->Register(static_cast<Exchange::IPowerManager::IModePreChangeNotification *>(&m_powerModeSink));
+            }
+            if (status != Core::ERROR_NONE)
+            {
+                MM_LOGINFO("Failed to register for power mode notifications, error %u", status);
+                unsubscribeFromPowerStateEvents();
+                return false;
+            }
+
+            Exchange::IPowerManager::PowerState current = Exchange::IPowerManager::POWER_STATE_UNKNOWN;
+            Exchange::IPowerManager::PowerState previous = Exchange::IPowerManager::POWER_STATE_UNKNOWN;
+            if (m_powerManager->GetPowerState(current, previous) == Core::ERROR_NONE)
+            {
+                m_power_state = powerStateFromManager(current);
+                onDeviceUseChanged();
+            }
+            MM_LOGINFO("MaintenanceManager registered for power mode notifications, power state %d", (int)m_power_state);
+            return true;
+        }
+
+        /**
+         * @brief Unregisters the power mode notifications and releases org.rdk.PowerManager.
+         */
+        void MaintenanceManager::unsubscribeFromPowerStateEvents()
+        {
+            if (m_powerManager)
+            {
+                m_powerManager->Unregister(static_cast<Exchange::IPowerManager::IModeChangedNotification *>(&m_powerModeSink));
+                m_powerManager->Unregister(static_cast<Exchange::IPowerManager::IModePreChangeNotification *>(&m_powerModeSink));
+                m_powerManager.Reset();
+            }
+        }
+
+        /**
+         * @brief Handles the power mode changes of org.rdk.PowerManager.
+         *
+         * @param state The power state the device is now in.
+         */
+        void MaintenanceManager::onPowerModeChanged(Exchange::IPowerManager::PowerState state)
+        {
+            MM_LOGINFO("Received power mode change to %d", (int)state);
+            m_power_state = powerStateFromManager(state);
+            onDeviceUseChanged();
+        }
+
+        /**
+         * @brief Handles the announced power mode changes of org.rdk.PowerManager.
+         *
+         * Holds deferrable tasks as soon as deep sleep is announced, rather
+         * than starting a download the device is about to suspend.
+         *
+         * @param state The power state the device is about to enter.
+         */
+        void MaintenanceManager::onPowerModePreChange(Exchange::IPowerManager::PowerState state)
+        {
+            Maint_power_state_t power_state = powerStateFromManager(state);
+            if (power_state == MAINT_POWER_DEEP_STANDBY || power_state == MAINT_POWER_OFF)
+            {
+                MM_LOGINFO("Received power mode pre-change to %d", (int)state);
+                m_power_state = power_state;
+            }
+        }
+
         MaintenanceManager::~MaintenanceManager()
         {
+            stopTaskSupervisor();
             MaintenanceManager::_instance = nullptr;
         }
 
@@ -1490,10 +3258,58 @@ namespace WPEFramework
         {
             ASSERT(service != nullptr);
             ASSERT(m_service == nullptr);
-            ASSERT(timerid != nullptr);
 
+#if defined(ENABLE_ASYNC_LOGGING)
+            /* From here on lines are written by the log writer thread */
+            Utils::AsyncLog::instance().start();
+#endif
             m_service = service;
             m_service->AddRef();
+
+            Config config;
+            config.FromString(service->ConfigLine());
+            if (config.MaxParallelTasks.IsSet() && config.MaxParallelTasks.Value() > 0)
+            {
+                m_max_parallel_tasks = config.MaxParallelTasks.Value();
+            }
+            MM_LOGINFO("Maximum parallel tasks: %d", (int)m_max_parallel_tasks);
+            m_resume_window = config.ResumeWindow.Value();
+            m_deinitializing = false;
+            loadStartTimeJitter(config.DeviceIdFile.Value(), config.StartWindow.Value());
+            m_max_deferral = config.MaxDeferral.Value();
+
+            loadTaskRegistry(config.Tasks);
+            m_process_index.setNames({m_tasks[TASK_RFC].processName, m_tasks[TASK_SWUPDATE].processName, m_tasks[TASK_LOGUPLOAD].processName});
+
+            {
+                std::lock_guard<std::mutex> lock(m_processMutex);
+                m_background_io_max = config.BackgroundIoMax.Value();
+                if (config.CgroupRoot.Value().empty())
+                {
+                    MM_LOGINFO("Tasks run in the plugin's cgroup");
+                }
+                else if (m_cgroup.open(config.CgroupRoot.Value()))
+                {
+                    MM_LOGINFO("Tasks are contained in %s", config.CgroupRoot.Value().c_str());
+                }
+                else
+                {
+                    MM_LOGWARN("cgroup v2 unavailable at '%s', tasks run without resource limits", config.CgroupRoot.Value().c_str());
+                }
+            }
+
+            /* Keeps the maintenance start time cached from here on */
+            startTaskSupervisor();
+
+            /* Lets the maintenance thread wait for the plugins it depends on */
+            m_service->Register(&m_pluginStateSink);
+            m_pluginStateRegistered = true;
+
+            if (m_max_deferral > 0)
+            {
+                m_power_subscribed = subscribeToPowerStateEvents();
+            }
+
             if ((g_whoami_support_enabled = isWhoAmIEnabled())) {
                 MM_LOGINFO("WhoAmI feature is enabled");
                 subscribeToDeviceInitializationEvent();
@@ -1504,13 +3320,6 @@ namespace WPEFramework
 #if defined(USE_IARMBUS) || defined(USE_IARM_BUS)
             InitializeIARM();
 #endif
-            // Register Signal Handler
-            if (signal(SIGALRM, timer_handler) == SIG_ERR)
-            {
-                MM_LOGERR("Failed to register signal handler");
-                return string("Failed to register signal handler");
-            }
-            MM_LOGINFO("Signal Handler registered for Timer");
 
             /* On Success; return empty to indicate no error text. */
             return (string());
@@ -1518,15 +3327,45 @@ namespace WPEFramework
 
         void MaintenanceManager::Deinitialize(PluginHost::IShell *service)
         {
-            if (!maintenance_deleteTimer())
-            {
-                MM_LOGINFO("Failed to delete timer");
-            }
-            MM_LOGINFO("Timer Deleted on Deinitialization.");
+            m_deinitializing = true;
 #if defined(USE_IARMBUS) || defined(USE_IARM_BUS)
             stopMaintenanceTasks();
             DeinitializeIARM();
 #endif /* defined(USE_IARMBUS) || defined(USE_IARM_BUS) */
+            stopTaskSupervisor();
+            MM_LOGINFO("Task supervisor stopped on Deinitialization.");
+            /* The queue is shared with the rest of the process and keeps running */
+            Utils::Telemetry::batcher().flush();
+            if (Utils::Telemetry::batcher().dropped() > 0)
+            {
+                MM_LOGWARN("%llu telemetry events were dropped", (unsigned long long)Utils::Telemetry::batcher().dropped());
+            }
+            if (m_pluginStateRegistered)
+            {
+                m_service->Unregister(&m_pluginStateSink);
+                m_pluginStateRegistered = false;
+            }
+            {
+                std::lock_guard<std::mutex> lock(m_linkMutex);
+                MM_LOGINFO("Closing %zu JSON-RPC links (%u created, %u reused)", m_thunder_links.size(), m_link_creations, m_link_reuses);
+                m_thunder_links.clear();
+            }
+            g_subscribed_for_nwevents = false;
+            g_subscribed_for_deviceContextUpdate = false;
+            unsubscribeFromPowerStateEvents();
+            m_power_subscribed = false;
+            m_power_state = MAINT_POWER_UNKNOWN;
+            m_playback_active = false;
+            setInternetState(INTERNET_UNKNOWN_STATE);
+            /* stopMaintenanceTasks() only covers IARM builds; nothing may outlive the plugin */
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                if (!reapTask(i) && !killTask(i))
+                {
+                    MM_LOGERR("%s is still running after SIGKILL, no longer tracked", m_tasks[i].command.c_str());
+                    reapTask(i, true);
+                }
+            }
 
             ASSERT(service == m_service);
 
@@ -1538,6 +3377,10 @@ namespace WPEFramework
                 m_authservicePlugin->Release();
                 m_authservicePlugin = nullptr;
             }
+#if defined(ENABLE_ASYNC_LOGGING)
+            /* Writes what is still buffered; later lines are written synchronously */
+            Utils::AsyncLog::instance().stop();
+#endif
         }
 
 #if defined(USE_IARMBUS) || defined(USE_IARM_BUS)
@@ -1572,9 +3415,11 @@ namespace WPEFramework
             if (!checkValidOptOutModes(OptOutmode))
             {
                 MM_LOGINFO("OptOut Value is not Set. Setting to NONE");
+                m_setting.begin();
                 m_setting.remove("softwareoptout");
                 OptOutmode = "NONE";
                 m_setting.setValue("softwareoptout", std::move(OptOutmode));
+                m_setting.commit();
             }
             else
             {
@@ -1629,17 +3474,16 @@ namespace WPEFramework
         void MaintenanceManager::iarmEventHandler(const char *owner, IARM_EventId_t eventId, void *data, size_t len)
         {
             m_statusMutex.lock();
+            /* time m_statusMutex is held, which delays every other status change */
+            auto locked = std::chrono::steady_clock::now();
+            auto unlock = [this, &locked]() {
+                m_event_lock_hold.record((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - locked).count());
+                m_statusMutex.unlock();
+            };
             if (!m_abort_flag)
             {
-                Maint_notify_status_t notify_status = MAINTENANCE_STARTED;
                 IARM_Bus_MaintMGR_EventData_t *module_event_data = (IARM_Bus_MaintMGR_EventData_t *)data;
                 IARM_Maint_module_status_t module_status;
-                time_t successfulTime;
-                string str_successfulTime = "";
-
-                auto task_status_RFC = m_task_map.find(task_names_foreground[TASK_RFC].c_str());
-                auto task_status_SWUPDATE = m_task_map.find(task_names_foreground[TASK_SWUPDATE].c_str());
-                auto task_status_LOGUPLOAD = m_task_map.find(task_names_foreground[TASK_LOGUPLOAD].c_str());
 
                 IARM_Bus_MaintMGR_EventId_t event = (IARM_Bus_MaintMGR_EventId_t)eventId;
                 MM_LOGINFO("Maintenance Event-ID = %d", event);
@@ -1655,188 +3499,84 @@ namespace WPEFramework
 
 						if (status_string == "MAINTENANCE_RFC_ERROR") 
 						{
-							t2_event_d("SYST_ERR_RFC", 1);
+							Utils::Telemetry::batcher().count("SYST_ERR_RFC");
 						}
 						
-                        switch (module_status)
+                        int task_index = -1;
+                        Maint_task_event_t kind = TASK_EVENT_NONE;
+                        if (lookupTaskEvent(module_status, task_index, kind))
                         {
-                            case MAINT_RFC_COMPLETE:
-                                if (task_status_RFC != m_task_map.end() && task_status_RFC->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event RFC_COMPLETE");
+                            const Maint_task_definition_t &task = m_tasks[task_index];
+                            switch (kind)
+                            {
+                                case TASK_EVENT_COMPLETE:
+                                    if (!m_task_active[task_index])
+                                    {
+                                        MM_LOGINFO("Ignoring Event %s", status_string.c_str());
+                                        break;
+                                    }
+                                    SET_STATUS(g_task_status, task.successBit);
+                                    SET_STATUS(g_task_status, task.completeBit);
+                                    recordTaskOutcome(task_index, TASK_OUTCOME_SUCCESS);
+                                    wakeTaskThread();
+                                    m_task_active[task_index] = false;
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, RFC_SUCCESS);
-                                    SET_STATUS(g_task_status, RFC_COMPLETE);
-                                    task_thread.notify_one();
-                                    m_task_map[task_names_foreground[TASK_RFC].c_str()] = false;
-                                }
-                                break;
-                            case MAINT_FWDOWNLOAD_COMPLETE:
-                                if (task_status_SWUPDATE != m_task_map.end() && task_status_SWUPDATE->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event MAINT_FWDOWNLOAD_COMPLETE");
+                                case TASK_EVENT_ERROR:
+                                    if (!m_task_active[task_index])
+                                    {
+                                        MM_LOGINFO("Ignoring Event %s", status_string.c_str());
+                                        break;
+                                    }
+                                    SET_STATUS(g_task_status, task.completeBit);
+                                    recordTaskOutcome(task_index, TASK_OUTCOME_ERROR);
+                                    wakeTaskThread();
+                                    MM_LOGINFO("Error encountered in %s Task", task.name.c_str());
+                                    m_task_active[task_index] = true;
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, SWUPDATE_SUCCESS);
-                                    SET_STATUS(g_task_status, SWUPDATE_COMPLETE);
-                                    task_thread.notify_one();
-                                    m_task_map[task_names_foreground[TASK_SWUPDATE].c_str()] = false;
-                                }
-                                break;
-                            case MAINT_LOGUPLOAD_COMPLETE:
-                                if (task_status_LOGUPLOAD != m_task_map.end() && task_status_LOGUPLOAD->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event MAINT_LOGUPLOAD_COMPLETE");
+                                case TASK_EVENT_INPROGRESS:
+                                    /* will be set to false once COMPLETE/ERROR is received for the task */
+                                    m_task_active[task_index] = true;
+                                    MM_LOGINFO(" %s already IN PROGRESS -> setting it active", task.name.c_str());
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, LOGUPLOAD_SUCCESS);
-                                    SET_STATUS(g_task_status, LOGUPLOAD_COMPLETE);
-                                    task_thread.notify_one();
-                                    m_task_map[task_names_foreground[TASK_LOGUPLOAD].c_str()] = false;
-                                }
-
-                                break;
-                            case MAINT_REBOOT_REQUIRED:
-                                SET_STATUS(g_task_status, REBOOT_REQUIRED);
-                                g_is_reboot_pending = "true";
-                                break;
-                            case MAINT_CRITICAL_UPDATE:
-                                g_is_critical_maintenance = "true";
-                                break;
-                            case MAINT_FWDOWNLOAD_ABORTED:
-                                SET_STATUS(g_task_status, TASK_SKIPPED);
-                                /* we say FW update task complete */
-                                SET_STATUS(g_task_status, SWUPDATE_COMPLETE);
-                                task_thread.notify_one();
-                                m_task_map[task_names_foreground[TASK_SWUPDATE].c_str()] = false;
-                                MM_LOGINFO("FW Download task aborted");
-                                break;
-                            case MAINT_RFC_ERROR:
-                                if (task_status_RFC != m_task_map.end() && task_status_RFC->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event RFC_ERROR");
+                                default:
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, RFC_COMPLETE);
-                                    task_thread.notify_one();
-                                    MM_LOGINFO("Error encountered in RFC Task");
-                                    m_task_map[task_names_foreground[TASK_RFC].c_str()] = true;
-                                }
-                                break;
-                            case MAINT_LOGUPLOAD_ERROR:
-                                if (task_status_LOGUPLOAD != m_task_map.end() && task_status_LOGUPLOAD->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event MAINT_LOGUPLOAD_ERROR");
+                            }
+                        }
+                        else
+                        {
+                            switch (module_status)
+                            {
+                                case MAINT_REBOOT_REQUIRED:
+                                    SET_STATUS(g_task_status, REBOOT_REQUIRED);
+                                    g_is_reboot_pending = "true";
+                                    publishStatus();
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, LOGUPLOAD_COMPLETE);
-                                    task_thread.notify_one();
-                                    MM_LOGINFO("Error encountered in LOGUPLOAD Task");
-                                    m_task_map[task_names_foreground[TASK_LOGUPLOAD].c_str()] = true;
-                                }
-                                break;
-                            case MAINT_FWDOWNLOAD_ERROR:
-                                if (task_status_SWUPDATE != m_task_map.end() && task_status_SWUPDATE->second != true)
-                                {
-                                    MM_LOGINFO("Ignoring Event MAINT_FWDOWNLOAD_ERROR");
+                                case MAINT_CRITICAL_UPDATE:
+                                    g_is_critical_maintenance = "true";
+                                    publishStatus();
                                     break;
-                                }
-                                else
-                                {
-                                    SET_STATUS(g_task_status, SWUPDATE_COMPLETE);
-                                    task_thread.notify_one();
-                                    MM_LOGINFO("Error encountered in SWUPDATE Task");
-                                    m_task_map[task_names_foreground[TASK_SWUPDATE].c_str()] = true;
-                                }
-                                break;
-                            case MAINT_RFC_INPROGRESS:
-                                m_task_map[task_names_foreground[TASK_RFC].c_str()] = true;
-                                /*will be set to false once COMEPLETE/ERROR received for RFC*/
-                                MM_LOGINFO(" RFC already IN PROGRESS -> setting m_task_map of RFC to true");
-                                break;
-                            case MAINT_FWDOWNLOAD_INPROGRESS:
-                                m_task_map[task_names_foreground[TASK_SWUPDATE].c_str()] = true;
-                                /*will be set to false once COMEPLETE/ERROR received for FWDOWNLOAD*/
-                                MM_LOGINFO(" FWDOWNLOAD already IN PROGRESS -> setting m_task_map of FWDOWNLOAD to true");
-                                break;
-                            case MAINT_LOGUPLOAD_INPROGRESS:
-                                m_task_map[task_names_foreground[TASK_LOGUPLOAD].c_str()] = true;
-                                /*will be set to false once COMEPLETE/ERROR received for LOGUPLOAD*/
-                                MM_LOGINFO(" LOGUPLOAD already IN PROGRESS -> setting m_task_map of LOGUPLOAD to true");
-                                break;
-                            default:
-                                break;
+                                case MAINT_FWDOWNLOAD_ABORTED:
+                                    SET_STATUS(g_task_status, TASK_SKIPPED);
+                                    /* we say FW update task complete */
+                                    SET_STATUS(g_task_status, m_tasks[TASK_SWUPDATE].completeBit);
+                                    recordTaskOutcome(TASK_SWUPDATE, TASK_OUTCOME_SKIPPED);
+                                    wakeTaskThread();
+                                    m_task_active[TASK_SWUPDATE] = false;
+                                    MM_LOGINFO("FW Download task aborted");
+                                    break;
+                                default:
+                                    break;
+                            }
                         }
                     }
                     else
                     {
                         MM_LOGINFO("Ignoring/Unknown Maintenance Status!!");
-                        m_statusMutex.unlock();
+                        unlock();
                         return;
                     }
 
-                    MM_LOGINFO(" BITFIELD Status : %x", g_task_status);
-                    /* Send the updated status only if all task completes execution
-                     * until that we say maintenance started */
-                    if ((g_task_status & TASKS_COMPLETED) == TASKS_COMPLETED)
-                    {
-                        if ((g_task_status & ALL_TASKS_SUCCESS) == ALL_TASKS_SUCCESS)
-                        { // all tasks success
-                            MM_LOGINFO("Maintenance Successfully Completed!!");
-                            notify_status = MAINTENANCE_COMPLETE;
-                            /*  we store the time in persistant location */
-                            successfulTime = time(nullptr);
-                            tm ltime = *localtime(&successfulTime);
-                            time_t epoch_time = mktime(&ltime);
-                            str_successfulTime = to_string(epoch_time);
-                            MM_LOGINFO("last succesful time is :%s", str_successfulTime.c_str());
-                            /* Remove any old completion time */
-                            m_setting.remove("LastSuccessfulCompletionTime");
-                            m_setting.setValue("LastSuccessfulCompletionTime", std::move(str_successfulTime));
-                        }
-                        /* Check other than all success case which means we have errors */
-                        else if ((g_task_status & ALL_TASKS_SUCCESS) != ALL_TASKS_SUCCESS)
-                        {
-                            if ((g_task_status & MAINTENANCE_TASK_SKIPPED) == MAINTENANCE_TASK_SKIPPED)
-                            {
-                                MM_LOGINFO("There are Skipped Task. Maintenance Incomplete");
-                                notify_status = MAINTENANCE_INCOMPLETE;
-                            }
-                            else
-                            {
-                                MM_LOGINFO("Maintenance Ended with Errors");
-                                notify_status = MAINTENANCE_ERROR;
-                            }
-                        }
-
-                        MM_LOGINFO("ENDING MAINTENANCE CYCLE");
-                        if (m_thread.joinable())
-                        {
-                            m_thread.join();
-                            MM_LOGINFO("Thread joined successfully");
-                        }
-
-                        if (g_maintenance_type == UNSOLICITED_MAINTENANCE && !g_unsolicited_complete)
-                        {
-                            g_unsolicited_complete = true;
-                        }
-                        MaintenanceManager::_instance->onMaintenanceStatusChange(notify_status);
-                    }
-                    else
-                    {
-                        MM_LOGINFO("Tasks are not completed!!!!");
-                    }
+                    endCycleIfComplete();
                 }
                 else
                 {
@@ -1847,7 +3587,7 @@ namespace WPEFramework
             {
                 MM_LOGINFO("Maintenance has been aborted. Hence ignoring the event");
             }
-            m_statusMutex.unlock();
+            unlock();
         }
         void MaintenanceManager::DeinitializeIARM()
         {
@@ -1881,83 +3621,34 @@ namespace WPEFramework
         /*
          * @brief This function returns the status of the current
          * or previous maintenance activity.
-         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceActivityStatus",
-         *                  "params":{}}''
-         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"status":MAINTENANCE_IDLE,"LastSuccessfulCompletionTime":
-                              -1,"isCriticalMaintenance":true,"isRebootPending":true}}
-         * @return: Core::<StatusCode>
-         */
-
-        uint32_t MaintenanceManager::getMaintenanceActivityStatus(const JsonObject &parameters,
-                                                                  JsonObject &response)
-        {
-            bool result = false;
-            string isCriticalMaintenance = "false";
-            string isRebootPending = "false";
-            string LastSuccessfulCompletionTime = "NA"; /* TODO : check max size to hold this */
-            string getMaintenanceStatusString = "\0";
-            bool b_criticalMaintenace = false;
-            bool b_rebootPending = false;
-
-            std::lock_guard<std::mutex> guard(m_callMutex);
-
-            /* Check if we have a critical maintenance */
-            if (!g_is_critical_maintenance.empty())
-            {
-                isCriticalMaintenance = g_is_critical_maintenance;
-            }
-
-            if (!g_is_reboot_pending.empty())
-            {
-                isRebootPending = g_is_reboot_pending;
-            }
-
-            /* Get the last SuccessfulCompletion time from Persistant location */
-            if (m_setting.contains("LastSuccessfulCompletionTime"))
-            {
-                LastSuccessfulCompletionTime = m_setting.getValue("LastSuccessfulCompletionTime").String();
-            }
-
-            if (!isCriticalMaintenance.compare("true"))
-            {
-                b_criticalMaintenace = true;
-            }
+         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceActivityStatus",
+         *                  "params":{}}''
+         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"status":MAINTENANCE_IDLE,"LastSuccessfulCompletionTime":
+                              -1,"isCriticalMaintenance":true,"isRebootPending":true}}
+         * @return: Core::<StatusCode>
+         */
 
-            if (!isRebootPending.compare("true"))
-            {
-                b_rebootPending = true;
-            }
+        uint32_t MaintenanceManager::getMaintenanceActivityStatus(const JsonObject &parameters,
+                                                                  JsonObject &response)
+        {
+            /* No lock: the snapshot is immutable and replaced as a whole by publishStatus() */
+            std::shared_ptr<const StatusSnapshot> snapshot = std::atomic_load(&m_status_snapshot);
+            Maint_notify_status_t status = snapshot->status;
 
-            response["maintenanceStatus"] = notifyStatusToString(m_notify_status);
+            response["maintenanceStatus"] = notifyStatusToString(status);
 
-			if (notifyStatusToString(m_notify_status) == "MAINTENANCE_INCOMPLETE")
+			if (MAINTENANCE_INCOMPLETE == status)
 			{
-				t2_event_d("SYST_INFO_MaintnceIncmpl", 1);
+				Utils::Telemetry::batcher().count("SYST_INFO_MaintnceIncmpl");
 			}
 			
-            if (strcmp("NA", LastSuccessfulCompletionTime.c_str()) == 0)
-            {
-                response["LastSuccessfulCompletionTime"] = 0; // stoi is not able handle "NA"
-            }
-            else
-            {
-                try
-                {
-                    response["LastSuccessfulCompletionTime"] = stoi(LastSuccessfulCompletionTime.c_str());
-                }
-                catch (exception &err)
-                {
-                    // exception caught with stoi -- So making "LastSuccessfulCompletionTime" as 0
-                    response["LastSuccessfulCompletionTime"] = 0;
-                }
-            }
-            response["isCriticalMaintenance"] = b_criticalMaintenace;
-            response["isRebootPending"] = b_rebootPending;
-            result = true;
+            response["LastSuccessfulCompletionTime"] = snapshot->lastSuccessfulCompletionTime;
+            response["isCriticalMaintenance"] = snapshot->isCriticalMaintenance;
+            response["isRebootPending"] = snapshot->isRebootPending;
 #if defined(ENABLE_JOURNAL_LOGGING)
-            MM_RETURN_RESPONSE(result);
+            MM_RETURN_RESPONSE(true);
 #endif
-            returnResponse(result);
+            returnResponse(true);
         }
 
         /**
@@ -2099,12 +3790,12 @@ namespace WPEFramework
          * and time zone mode. It then calculates the start time in seconds and considers the device's
          * local time zone and offset if necessary. The function returns the epoch time for the maintenance start.
          *
+         * @param rawtime The current time.
          * @return An integer representing the calculated start time in epoch format.
          *         Returns -1 if there is an error in reading the configuration or time zone files.
          */
-        /* Validate timezone string against an allowlist of safe characters
-         * to prevent shell command injection via crafted zoneValue.
-         * An empty zoneValue is allowed -- the shell treats TZ= as system default (safe). */
+        /* Validate timezone string against an allowlist of zoneinfo name characters.
+         * An empty zoneValue is allowed -- like TZ= it selects UTC. */
         static bool IsValidTimeZone(const char* tz)
         {
             if (tz == nullptr) {
@@ -2122,7 +3813,7 @@ namespace WPEFramework
             return true;
         }
 
-        int CalculateStartTime()
+        int CalculateStartTime(time_t rawtime)
         {
             char zoneValue[BUFFER_SIZE] = {0}, timeZoneOffset[BUFFER_SIZE] = {0}, timeZone[BUFFER_SIZE] = {0}, deviceName[BUFFER_SIZE] = {0};
             int start_hr = 0, start_min = 0;
@@ -2165,138 +3856,43 @@ namespace WPEFramework
             MM_LOGINFO("Read from config: start_hr=%d, start_min=%d, tz_mode=%s", start_hr, start_min, tz_mode);
             getTimeZone(deviceName, zoneValue, timeZone, timeZoneOffset, BUFFER_SIZE);
 
-            time_t rawtime = time(NULL);
-
             if (strcmp(tz_mode, "Local time") == 0)
             {
                 MM_LOGINFO("TimeZone is in Local time");
 
-                /* Reject timezone strings containing shell metacharacters. */
+                /* Reject timezone strings that are not zoneinfo names. */
                 if (!IsValidTimeZone(zoneValue))
                 {
                     MM_LOGERR("Invalid timezone value provided for local time calculation");
                     return -1;
                 }
 
-                char cmd[256];
-                char epoch_str[32] = {0};
-                char current_hhmm_str[8] = {0};
-
-                /* Get the current local time (HHMM) in TimeZone
-                 * and pick "today" or "tomorrow" based on the time in comparison with calculated maintenance time. */
-                snprintf(cmd, sizeof(cmd), "TZ=%s date +%%H%%M", zoneValue);
-                FILE *fp = popen(cmd, "r");
-                if (fp == NULL)
-                {
-                    MM_LOGERR("popen failed for current time query");
-                    return -1;
-                }
-                if (fgets(current_hhmm_str, sizeof(current_hhmm_str), fp) == NULL)
-                {
-                    MM_LOGERR("Failed to read current local time");
-                    pclose(fp);
-                    return -1;
-                }
-                pclose(fp);
+                /* Get the current local time in TimeZone and pick "today" or "tomorrow"
+                 * based on the time in comparison with calculated maintenance time. */
+                std::shared_ptr<const Utils::TimeZone> zone = Utils::TimeZone::Get(zoneValue);
+                struct tm now_tm;
+                zone->localTime(rawtime, now_tm);
 
-                int current_local_hhmm = atoi(current_hhmm_str);
+                int current_local_hhmm = (now_tm.tm_hour * 100) + now_tm.tm_min;
                 int maint_hhmm = (start_hr * 100) + start_min;
                 const char *when = (maint_hhmm > current_local_hhmm) ? "today" : "tomorrow";
                 MM_LOGINFO("Current local time: %04d, Maintenance time: %04d, Scheduled for: %s", current_local_hhmm, maint_hhmm, when);
+                MM_LOGINFO("Current local date in %s: %04d-%02d-%02d", zoneValue, now_tm.tm_year + 1900, now_tm.tm_mon + 1, now_tm.tm_mday);
 
-                /* Get today's local date in the target timezone as YYYY-MM-DD. */
-                char today_date_str[16] = {0};
-                snprintf(cmd, sizeof(cmd), "TZ=%s date +%%Y-%%m-%%d", zoneValue);
-                fp = popen(cmd, "r");
-                if (fp == NULL)
-                {
-                    MM_LOGERR("popen failed for date query");
-                    return -1;
-                }
-                if (fgets(today_date_str, sizeof(today_date_str), fp) == NULL)
-                {
-                    MM_LOGERR("Failed to read current local date");
-                    pclose(fp);
-                    return -1;
-                }
-                pclose(fp);
-                today_date_str[strcspn(today_date_str, "\n")] = '\0'; /* strip trailing newline */
-                MM_LOGINFO("Current local date in %s: %s", zoneValue, today_date_str);
-
-                /* Check sscanf return value before using parsed fields. */
-                struct tm date_tm = {0};
-                int parsed = sscanf(today_date_str, "%d-%d-%d", &date_tm.tm_year, &date_tm.tm_mon, &date_tm.tm_mday);
-                if (parsed != 3)
-                {
-                    MM_LOGERR("Failed to parse current local date string '%s'", today_date_str);
-                    return -1;
-                }
-                date_tm.tm_year -= 1900;
-                date_tm.tm_mon  -= 1;
-                date_tm.tm_isdst = -1;
-                if (strcmp(when, "tomorrow") == 0)
-                {
-                    date_tm.tm_mday += 1;
-                    mktime(&date_tm); /* normalise: updates tm_mday/mon/year in-place */
-                }
-                char scheduled_date[32];
-                snprintf(scheduled_date, sizeof(scheduled_date), "%04d-%02d-%02d", date_tm.tm_year + 1900, date_tm.tm_mon + 1, date_tm.tm_mday);
-                MM_LOGINFO("Scheduled maintenance date: %s %02d:%02d:00", scheduled_date, start_hr, start_min);
-
-                /* Calculate epoch of the maintenance time on that
-                 * specific date with date -d command in the target timezone.
-                 * strtol (not atoi) avoids 32-bit overflow post-2038. */
-                snprintf(cmd, sizeof(cmd), "TZ=%s date -d '%s %02d:%02d:00' +%%s", zoneValue, scheduled_date, start_hr, start_min);
-                fp = popen(cmd, "r");
-                if (fp == NULL)
-                {
-                    MM_LOGERR("popen failed for epoch query");
-                    return -1;
-                }
-                if (fgets(epoch_str, sizeof(epoch_str), fp) == NULL)
-                {
-                    MM_LOGERR("Failed to read maintenance epoch");
-                    pclose(fp);
-                    return -1;
-                }
-                pclose(fp);
+                int year = now_tm.tm_year + 1900;
+                int month = now_tm.tm_mon + 1;
+                int day = now_tm.tm_mday + ((strcmp(when, "tomorrow") == 0) ? 1 : 0);
+                MM_LOGINFO("Scheduled maintenance date: %04d-%02d-%02d %02d:%02d:00", year, month, day, start_hr, start_min);
 
-                long start_epoch = strtol(epoch_str, NULL, 10);
-                if (start_epoch <= 0)
-                {
-                    MM_LOGERR("Invalid epoch from date command: %s", epoch_str);
-                    return -1;
-                }
+                /* Epoch of the maintenance time on that date in the target timezone,
+                 * resolved across DST changes the way date -d does. */
+                long start_epoch = (long)zone->toUtc(year, month, day, start_hr, start_min, 0);
 
-                /* Safety fallback — if still in the past, re-query for
-                 * next day; treat any popen/fgets failure as a hard error (return -1). */
+                /* Safety fallback — if still in the past, recalculate for next day */
                 if (start_epoch - (long)rawtime < 10)
                 {
                     MM_LOGINFO("Calculated maintenance time is in the past, recalculating for next day");
-                    date_tm.tm_mday += 1;
-                    mktime(&date_tm); /* normalise overflow */
-                    char next_date[32];
-                    snprintf(next_date, sizeof(next_date), "%04d-%02d-%02d", date_tm.tm_year + 1900, date_tm.tm_mon + 1, date_tm.tm_mday);
-                    snprintf(cmd, sizeof(cmd), "TZ=%s date -d '%s %02d:%02d:00' +%%s", zoneValue, next_date, start_hr, start_min);
-                    fp = popen(cmd, "r");
-                    if (fp == NULL)
-                    {
-                        MM_LOGERR("popen failed during next-day recalculation");
-                        return -1;
-                    }
-                    if (fgets(epoch_str, sizeof(epoch_str), fp) == NULL)
-                    {
-                        pclose(fp);
-                        MM_LOGERR("Failed to read next-day maintenance epoch");
-                        return -1;
-                    }
-                    pclose(fp);
-                    start_epoch = strtol(epoch_str, NULL, 10);
-                    if (start_epoch <= 0)
-                    {
-                        MM_LOGERR("Invalid next-day epoch from date command: %s", epoch_str);
-                        return -1;
-                    }
+                    start_epoch = (long)zone->toUtc(year, month, day + 1, start_hr, start_min, 0);
                 }
 
                 /* use long to avoid Coverity INTEGER_OVERFLOW on the log and return. */
@@ -2324,6 +3920,11 @@ namespace WPEFramework
             }
         }
 
+        int CalculateStartTime()
+        {
+            return CalculateStartTime(time(NULL));
+        }
+
         /*
          * @brief This function returns the start time of the maintenance activity.
          * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceStartTime","params":{}}''
@@ -2332,7 +3933,7 @@ namespace WPEFramework
          */
         uint32_t MaintenanceManager::getMaintenanceStartTime(const JsonObject &parameters, JsonObject &response)
         {
-            int maintenance_start_time = CalculateStartTime();
+            int maintenance_start_time = getCachedMaintenanceStartTime();
             response["maintenanceStartTime"] = maintenance_start_time;
 #if defined(ENABLE_JOURNAL_LOGGING)
             MM_RETURN_RESPONSE(true);
@@ -2400,6 +4001,55 @@ namespace WPEFramework
             }
         }
 
+        /*
+         * @brief Caches the opt-out this plugin just wrote to the record file.
+         * @param1[in]: optout - the value of softwareoptout
+         */
+        void MaintenanceManager::cacheOptOut(const string &optout)
+        {
+            std::lock_guard<std::mutex> guard(m_optoutMutex);
+            m_optout = optout;
+            if (stat(MAINTENANCE_MGR_RECORD_FILE, &m_optout_stat) != 0)
+            {
+                m_optout_stat = {};
+            }
+        }
+
+        /*
+         * @brief Gets the opt-out of the record file. The file is read only when it
+         *        is not the one the cached value came from; m_setting is left alone.
+         * @param1[out]: optout - the value of softwareoptout
+         * @return: false if the file or the value is missing
+         */
+        bool MaintenanceManager::readOptOut(string &optout)
+        {
+            struct stat st;
+            if (stat(MAINTENANCE_MGR_RECORD_FILE, &st) != 0)
+            {
+                return false;
+            }
+            {
+                std::lock_guard<std::mutex> guard(m_optoutMutex);
+                if (st.st_ino == m_optout_stat.st_ino && st.st_dev == m_optout_stat.st_dev && st.st_size == m_optout_stat.st_size
+                    && st.st_mtim.tv_sec == m_optout_stat.st_mtim.tv_sec && st.st_mtim.tv_nsec == m_optout_stat.st_mtim.tv_nsec)
+                {
+                    optout = m_optout;
+                    return !optout.empty();
+                }
+            }
+
+            /* read without the lock; a file replaced meanwhile no longer matches st and is read again next time */
+            string value;
+            parseConfigFile(MAINTENANCE_MGR_RECORD_FILE, "softwareoptout", value);
+            {
+                std::lock_guard<std::mutex> guard(m_optoutMutex);
+                m_optout = value;
+                m_optout_stat = st;
+            }
+            optout = std::move(value);
+            return !optout.empty();
+        }
+
         /*
          * @brief This function returns Mode of the maintenance.
          * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceMode","params":{}}''
@@ -2422,41 +4072,33 @@ namespace WPEFramework
             }
             else
             {
-                std::lock_guard<std::mutex> guard(m_callMutex); // Add Mutex to prevent Data race
-                response["maintenanceMode"] = g_currentMode;
-                response["triggerMode"] = g_triggerMode;
+                {
+                    std::lock_guard<std::mutex> guard(m_callMutex); // Add Mutex to prevent Data race
+                    response["maintenanceMode"] = g_currentMode;
+                    response["triggerMode"] = g_triggerMode;
+                }
 
-                if (Utils::fileExists(MAINTENANCE_MGR_RECORD_FILE))
+                /* served from the opt-out cache; the record file is read only if someone else replaced it */
+                if (readOptOut(softwareOptOutmode))
                 {
-                    if (parseConfigFile(MAINTENANCE_MGR_RECORD_FILE, "softwareoptout", softwareOptOutmode))
+                    /* check if the value is valid */
+                    MM_LOGINFO("Successfully read OptOut value from %s", MAINTENANCE_MGR_RECORD_FILE);
+                    if (!checkValidOptOutModes(softwareOptOutmode))
                     {
-                        /* check if the value is valid */
-                        MM_LOGINFO("Successfully read OptOut value from %s", MAINTENANCE_MGR_RECORD_FILE);
-                        if (!checkValidOptOutModes(softwareOptOutmode))
-                        {
-                            MM_LOGERR("Invalid OptOut Value");
+                        MM_LOGERR("Invalid OptOut Value");
 #if defined(ENABLE_JOURNAL_LOGGING)
-                            MM_RETURN_RESPONSE(false);
+                        MM_RETURN_RESPONSE(false);
 #endif
-                            returnResponse(false);
-                        }
-                        else
-                        {
-                            MM_LOGINFO("Valid OptOut Value = %s", softwareOptOutmode.c_str());
-                        }
+                        returnResponse(false);
                     }
                     else
                     {
-                        MM_LOGERR("OptOut Value Not Found");
-#if defined(ENABLE_JOURNAL_LOGGING)
-                        MM_RETURN_RESPONSE(false);
-#endif
-                        returnResponse(false);
+                        MM_LOGINFO("Valid OptOut Value = %s", softwareOptOutmode.c_str());
                     }
                 }
                 else
                 {
-                    MM_LOGERR("%s File Not Found to get OptOut Value", MAINTENANCE_MGR_RECORD_FILE);
+                    MM_LOGERR("OptOut Value Not Found in %s", MAINTENANCE_MGR_RECORD_FILE);
 #if defined(ENABLE_JOURNAL_LOGGING)
                     MM_RETURN_RESPONSE(false);
 #endif
@@ -2471,6 +4113,278 @@ namespace WPEFramework
             returnResponse(result);
         }
 
+        /*
+         * @brief This function returns latency percentiles of the maintenance phases, in milliseconds.
+         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceMetrics","params":{"reset":false}}''
+         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"phases":{"activation":{"count":2,"p50":120,"p95":135,"p99":135,"max":131},...},
+         *               "eventLockHold":{"count":9,"p50":3,"p95":15,"p99":15,"max":14},
+         *               "tasks":{"RFC":{"runs":2,"cpuUserMs":420,"cpuSystemMs":130,"maxRssKb":5120,"readBytes":81920,"writeBytes":4096,
+         *               "storageReadBytes":65536,"storageWriteBytes":4096,"memoryPeakKb":6144},...},"success":true}}
+         * @return: Core::<StatusCode>
+         */
+        uint32_t MaintenanceManager::getMaintenanceMetrics(const JsonObject &parameters,
+                                                           JsonObject &response)
+        {
+            static const char *phase_names[MAX_MAINTENANCE_PHASES] = {
+                "activation", "whoAmI", "network", "RFC", "SWUPDATE", "LOGUPLOAD"};
+
+            MM_LOGINFO("Invoke getMaintenanceMetrics");
+            JsonObject phases;
+            for (int i = 0; i < MAX_MAINTENANCE_PHASES; i++)
+            {
+                const Utils::LatencyHistogram &histogram = m_phase_latency[i];
+                JsonObject phase;
+                phase["count"] = histogram.count();
+                phase["p50"] = histogram.percentile(50);
+                phase["p95"] = histogram.percentile(95);
+                phase["p99"] = histogram.percentile(99);
+                phase["max"] = histogram.max();
+                phases[phase_names[i]] = phase;
+            }
+            response["phases"] = phases;
+
+            JsonObject lockHold;
+            lockHold["count"] = m_event_lock_hold.count();
+            lockHold["p50"] = m_event_lock_hold.percentile(50);
+            lockHold["p95"] = m_event_lock_hold.percentile(95);
+            lockHold["p99"] = m_event_lock_hold.percentile(99);
+            lockHold["max"] = m_event_lock_hold.max();
+            response["eventLockHold"] = lockHold;
+
+            JsonObject telemetry;
+            telemetry["delivered"] = Utils::Telemetry::batcher().delivered();
+            telemetry["dropped"] = Utils::Telemetry::batcher().dropped();
+            response["telemetry"] = telemetry;
+
+            JsonObject logging;
+            logging["dropped"] = Utils::AsyncLog::instance().dropped();
+            response["logging"] = logging;
+
+            JsonObject tasks;
+            {
+                std::lock_guard<std::mutex> lock(m_processMutex);
+                for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+                {
+                    const Utils::ProcessUsage &usage = m_task_usage[i];
+                    JsonObject task;
+                    task["runs"] = m_task_runs[i];
+                    task["cpuUserMs"] = usage.cpuUserMs;
+                    task["cpuSystemMs"] = usage.cpuSystemMs;
+                    task["maxRssKb"] = usage.maxRssKb;
+                    task["readBytes"] = usage.readBytes;
+                    task["writeBytes"] = usage.writeBytes;
+                    task["storageReadBytes"] = usage.storageReadBytes;
+                    task["storageWriteBytes"] = usage.storageWriteBytes;
+                    task["memoryPeakKb"] = usage.memoryPeakKb;
+                    tasks[m_tasks[i].name.c_str()] = task;
+                }
+            }
+            response["tasks"] = tasks;
+
+            /* the response still holds the values from before the reset */
+            if (parameters.HasLabel("reset") && parameters["reset"].Boolean())
+            {
+                MM_LOGINFO("Resetting maintenance phase metrics");
+                for (auto &histogram : m_phase_latency)
+                {
+                    histogram.reset();
+                }
+                m_event_lock_hold.reset();
+                std::lock_guard<std::mutex> lock(m_processMutex);
+                memset(m_task_usage, 0, sizeof(m_task_usage));
+                memset(m_task_runs, 0, sizeof(m_task_runs));
+            }
+#if defined(ENABLE_JOURNAL_LOGGING)
+            MM_RETURN_RESPONSE(true);
+#endif
+            returnResponse(true);
+        }
+
+        /*
+         * @brief This function changes the timeout and retry policy of a task until the plugin is reactivated.
+         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.setTaskPolicy",
+         *              "params":{"task":"SWUPDATE","timeout":1800,"attempts":3,"retryDelay":10,"retryDelayMax":300}}
+         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"timeout":1800,"attempts":3,"retryDelay":10,"retryDelayMax":300,"success":true}}
+         * @return: Core::<StatusCode>
+         */
+        uint32_t MaintenanceManager::setTaskPolicy(const JsonObject &parameters,
+                                                   JsonObject &response)
+        {
+            MM_LOGINFO("Invoke setTaskPolicy");
+            string name = parameters.HasLabel("task") ? parameters["task"].String() : "";
+            int task_index = 0;
+            while (task_index < MAX_MAINTENANCE_TASKS && m_tasks[task_index].name != name)
+            {
+                task_index++;
+            }
+            if (task_index == MAX_MAINTENANCE_TASKS)
+            {
+                MM_LOGERR("Unknown task '%s'", name.c_str());
+#if defined(ENABLE_JOURNAL_LOGGING)
+                MM_RETURN_RESPONSE(false);
+#endif
+                returnResponse(false);
+            }
+
+            auto invalid = [&parameters](const char *field, int64_t min, int64_t max) {
+                return parameters.HasLabel(field) && (parameters[field].Number() < min || parameters[field].Number() > max);
+            };
+            if (invalid("timeout", 1, INT32_MAX) || invalid("attempts", 1, UINT8_MAX) ||
+                invalid("retryDelay", 0, INT32_MAX) || invalid("retryDelayMax", 0, INT32_MAX))
+            {
+                MM_LOGERR("Invalid policy for task %s", name.c_str());
+#if defined(ENABLE_JOURNAL_LOGGING)
+                MM_RETURN_RESPONSE(false);
+#endif
+                returnResponse(false);
+            }
+
+            /* the maintenance thread reads the policy with m_callMutex held */
+            std::lock_guard<std::mutex> guard(m_callMutex);
+            Maint_task_definition_t &task = m_tasks[task_index];
+            if (parameters.HasLabel("timeout"))
+            {
+                task.timeout = (int)parameters["timeout"].Number();
+            }
+            if (parameters.HasLabel("attempts"))
+            {
+                task.attempts = (uint8_t)parameters["attempts"].Number();
+            }
+            if (parameters.HasLabel("retryDelay"))
+            {
+                task.retryDelay = (int)parameters["retryDelay"].Number();
+            }
+            if (parameters.HasLabel("retryDelayMax"))
+            {
+                task.retryDelayMax = (int)parameters["retryDelayMax"].Number();
+            }
+            MM_LOGINFO("Task %s: timeout %d seconds, %d attempts, retry delay %d to %d seconds",
+                       task.name.c_str(), task.timeout, (int)task.attempts, task.retryDelay, task.retryDelayMax);
+            response["timeout"] = task.timeout;
+            response["attempts"] = (int)task.attempts;
+            response["retryDelay"] = task.retryDelay;
+            response["retryDelayMax"] = task.retryDelayMax;
+#if defined(ENABLE_JOURNAL_LOGGING)
+            MM_RETURN_RESPONSE(true);
+#endif
+            returnResponse(true);
+        }
+
+        /*
+         * @brief This function tells whether media is playing, holding deferrable tasks while it does.
+         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.setPlaybackState","params":{"active":true}}
+         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"success":true}}
+         * @return: Core::<StatusCode>
+         */
+        uint32_t MaintenanceManager::setPlaybackState(const JsonObject &parameters,
+                                                      JsonObject &response)
+        {
+            MM_LOGINFO("Invoke setPlaybackState");
+            if (!parameters.HasLabel("active") || parameters["active"].Content() != Core::JSON::Variant::type::BOOLEAN)
+            {
+                MM_LOGERR("Missing or invalid 'active'");
+#if defined(ENABLE_JOURNAL_LOGGING)
+                MM_RETURN_RESPONSE(false);
+#endif
+                returnResponse(false);
+            }
+
+            m_playback_active = parameters["active"].Boolean();
+            MM_LOGINFO("Playback %s", m_playback_active ? "active" : "stopped");
+            onDeviceUseChanged();
+#if defined(ENABLE_JOURNAL_LOGGING)
+            MM_RETURN_RESPONSE(true);
+#endif
+            returnResponse(true);
+        }
+
+        /*
+         * @brief This function returns recorded maintenance cycles, newest first.
+         * @param1[in]: {"jsonrpc":"2.0","id":"3","method":"org.rdk.MaintenanceManager.1.getMaintenanceHistory","params":{"offset":0,"limit":1}}''
+         * @param2[out]: {"jsonrpc":"2.0","id":3,"result":{"total":5,"cycles":[{"startTime":1727266140,"endTime":1727266201,
+         *               "maintenanceType":"UNSOLICITED","maintenanceStatus":"MAINTENANCE_COMPLETE","networkWaitTime":1200,
+         *               "tasks":[{"name":"RFC","startTime":1727266141,"endTime":1727266160,"outcome":"SUCCESS","attempts":1},...]}],"success":true}}
+         * @return: Core::<StatusCode>
+         */
+        uint32_t MaintenanceManager::getMaintenanceHistory(const JsonObject &parameters,
+                                                           JsonObject &response)
+        {
+            MM_LOGINFO("Invoke getMaintenanceHistory");
+            uint32_t offset = 0;
+            uint32_t limit = MAINTENANCE_HISTORY_MAX_PAGE;
+
+            if (parameters.HasLabel("offset"))
+            {
+                int64_t value = parameters["offset"].Number();
+                if (value < 0)
+                {
+                    MM_LOGERR("Invalid offset %lld", (long long)value);
+#if defined(ENABLE_JOURNAL_LOGGING)
+                    MM_RETURN_RESPONSE(false);
+#endif
+                    returnResponse(false);
+                }
+                offset = (uint32_t)value;
+            }
+            if (parameters.HasLabel("limit"))
+            {
+                int64_t value = parameters["limit"].Number();
+                if (value <= 0)
+                {
+                    MM_LOGERR("Invalid limit %lld", (long long)value);
+#if defined(ENABLE_JOURNAL_LOGGING)
+                    MM_RETURN_RESPONSE(false);
+#endif
+                    returnResponse(false);
+                }
+                if (value < MAINTENANCE_HISTORY_MAX_PAGE)
+                {
+                    limit = (uint32_t)value;
+                }
+            }
+
+            uint32_t total = m_history.count();
+            JsonArray cycles;
+            for (uint32_t index = offset; index < total && index < offset + limit; index++)
+            {
+                HistoryRecord record;
+                if (!m_history.read(index, &record))
+                {
+                    MM_LOGWARN("Maintenance history entry %u is unreadable", index);
+                    continue;
+                }
+
+                Maint_notify_status_t status = (Maint_notify_status_t)record.status;
+                JsonObject cycle;
+                cycle["startTime"] = record.startTime;
+                cycle["endTime"] = record.endTime;
+                cycle["maintenanceType"] = (record.type == SOLICITED_MAINTENANCE) ? "SOLICITED" : "UNSOLICITED";
+                cycle["maintenanceStatus"] = notifyStatusToString(status);
+                cycle["networkWaitTime"] = record.networkWaitMs;
+
+                JsonArray tasks;
+                for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+                {
+                    JsonObject task;
+                    task["name"] = m_tasks[i].name;
+                    task["startTime"] = record.tasks[i].startTime;
+                    task["endTime"] = record.tasks[i].endTime;
+                    task["outcome"] = taskOutcomeToString(record.tasks[i].outcome);
+                    task["attempts"] = record.tasks[i].attempts;
+                    tasks.Add(task);
+                }
+                cycle["tasks"] = tasks;
+                cycles.Add(cycle);
+            }
+
+            response["total"] = total;
+            response["cycles"] = cycles;
+#if defined(ENABLE_JOURNAL_LOGGING)
+            MM_RETURN_RESPONSE(true);
+#endif
+            returnResponse(true);
+        }
+
         /*
          * @brief This function returns the current status of the current
          * or previous maintenance activity.
@@ -2517,6 +4431,9 @@ namespace WPEFramework
                 std::lock_guard<std::mutex> guard(m_callMutex); // Add Mutex
                 g_triggerMode = std::move(new_trigger_mode); // Update inside mutex lock
 
+                /* mode and optOut are written to the record file once, below */
+                m_setting.begin();
+
                 /* check if maintenance is on progress or not */
                 /* if in progress restrict the same */
                 if (MAINTENANCE_STARTED != m_notify_status)
@@ -2564,6 +4481,12 @@ namespace WPEFramework
                     result = true;
                 }
 
+                if (old_mode != g_currentMode)
+                {
+                    /* tasks already running follow the new mode too */
+                    applyTaskLimits(BACKGROUND_MODE == g_currentMode);
+                }
+
                 MM_LOGINFO("SetMaintenanceMode optOut = %s", new_optout_state.c_str());
 
                 /* check if we have a valid state from user */
@@ -2571,10 +4494,13 @@ namespace WPEFramework
                 {
                     /* we got a valid state; Now store it in persistant location */
                     m_setting.setValue("softwareoptout", new_optout_state);
+                    m_setting.commit();
+                    cacheOptOut(new_optout_state);
                     MM_LOGINFO("Valid optOut = %s", new_optout_state.c_str());
                 }
                 else
                 {
+                    m_setting.commit();
                     MM_LOGINFO("Invalid optOut = %s", new_optout_state.c_str());
 #if defined(ENABLE_JOURNAL_LOGGING)
                     MM_RETURN_RESPONSE(false);
@@ -2658,6 +4584,7 @@ namespace WPEFramework
                     g_is_critical_maintenance = std::move(prev_critical_maintenance);
                     result = false;
                 }
+                publishStatus();
             }
             else
             {
@@ -2695,7 +4622,7 @@ namespace WPEFramework
             string codeDLtask;
             int k_ret = EINVAL;
             int i = 0;
-            bool task_status[3] = {false};
+            bool task_status[MAX_MAINTENANCE_TASKS] = {false};
             bool result = false;
             
             /* run only when the maintenance status is MAINTENANCE_STARTED */
@@ -2704,39 +4631,36 @@ namespace WPEFramework
             {
                 MM_LOGINFO("Stopping maintenance activities");
                 // Set the condition flag m_abort_flag to true
-                m_abort_flag = true;
-                auto task_status_RFC = m_task_map.find(task_names_foreground[TASK_RFC].c_str());
-                if (task_status_RFC != m_task_map.end()) {
-                    task_status[0] = task_status_RFC->second;
+                {
+                    std::lock_guard<std::mutex> lock(m_networkMutex);
+                    m_abort_flag = true;
                 }
-
-                auto task_status_SWUPDATE = m_task_map.find(task_names_foreground[TASK_SWUPDATE].c_str());
-                if (task_status_SWUPDATE != m_task_map.end()) {
-                    task_status[1] = task_status_SWUPDATE->second;
+                /* A cycle still waiting for the network or a plugin gives up right away */
+                m_network_cv.notify_all();
+                {
+                    std::lock_guard<std::mutex> lock(m_pluginStateMutex);
                 }
-
-                auto task_status_LOGUPLOAD = m_task_map.find(task_names_foreground[TASK_LOGUPLOAD].c_str());
-                if (task_status_LOGUPLOAD != m_task_map.end()) {
-                    task_status[2] = task_status_LOGUPLOAD->second;
+                m_pluginState_cv.notify_all();
+                for (i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+                {
+                    task_status[i] = m_task_active[i];
                 }
 
-                for (i = 0; i < 3; i++)
+                for (i = 0; i < MAX_MAINTENANCE_TASKS; i++)
                 {
-                    MM_LOGINFO("task status [%d]  = %s Task Name %s", i, (task_status[i]) ? "true" : "false", task_names[i].c_str());
+                    MM_LOGINFO("task status [%d]  = %s Task Name %s", i, (task_status[i]) ? "true" : "false", m_tasks[i].processName.c_str());
                 }
-                for (i = 0; i < 3; i++)
+                for (i = 0; i < MAX_MAINTENANCE_TASKS; i++)
                 {
                     if (task_status[i])
                     {
 
-                        k_ret = abortTask(task_names[i].c_str()); // default signal is SIGABRT
+                        k_ret = signalTask(i); // default signal is SIGABRT
 
                         if (k_ret == 0)
                         {                                                         // if task(s) was(were) killed successfully ...
-                            m_task_map[task_names_foreground[i].c_str()] = false; // set it to false
+                            m_task_active[i] = false; // set it to false
                         }
-                        /* No need to loop again */
-                        break;
                     }
                     else
                     {
@@ -2744,14 +4668,14 @@ namespace WPEFramework
                     }
                 }
                 result = true;
-                if (task_stopTimer())
+                if (task_stopAllTimers())
                 {
-                    MM_LOGINFO("Stopped Timer Successfully");
+                    MM_LOGINFO("Stopped Timers Successfully");
                 }
                 else{
-                    MM_LOGERR("task_stopTimer() did not stop the Timer");
+                    MM_LOGERR("task_stopAllTimers() did not stop the Timers");
                 }
-                task_thread.notify_one();
+                wakeTaskThread();
                 if (m_thread.joinable())
                 {
                     m_thread.join();
@@ -2824,6 +4748,11 @@ namespace WPEFramework
                 else
                 {
                     k_ret = kill(pid_num, sig_to_send);
+                    /* not a process group of its own: signal what it started as well */
+                    for (pid_t child : m_process_index.descendants(taskname))
+                    {
+                        kill(child, sig_to_send);
+                    }
                 }
                 MM_LOGINFO(" %s sent signal %d", taskname, sig_to_send);
                 if (k_ret == 0)
@@ -2842,49 +4771,10 @@ namespace WPEFramework
             return k_ret;
         }
 
-        /* Helper function to find the Task PID*/
+        /* Helper function to find the Task PID; task process names are indexed, other names scan /proc */
         pid_t MaintenanceManager::getTaskPID(const char *taskname)
         {
-
-            DIR *dir = opendir(PROC_DIR);
-            struct dirent *ent;
-            char *endptr;
-            char buf[512];
-
-            while ((ent = readdir(dir)) != NULL)
-            {
-                long lpid = strtol(ent->d_name, &endptr, 10);
-                if (*endptr != '\0')
-                {
-                    continue;
-                }
-                /* Get the PID */
-                snprintf(buf, sizeof(buf), "/proc/%ld/cmdline", lpid);
-
-                /* Open the cmdline and read */
-                FILE *fp = fopen(buf, "r");
-                if (fp)
-                {
-                    char *arg = 0;
-                    size_t size = 0;
-                    while (getdelim(&arg, &size, 0, fp) != -1)
-                    {
-                        printf("%s", arg);
-                        char *first = strstr(arg, taskname);
-                        if (first != NULL)
-                        {
-                            free(arg);
-                            fclose(fp);
-                            closedir(dir);
-                            return (pid_t)lpid;
-                        }
-                    }
-                    free(arg);
-                    fclose(fp);
-                }
-            }
-            closedir(dir);
-            return (pid_t)-1;
+            return m_process_index.find(taskname);
         }
 
         void MaintenanceManager::onMaintenanceStatusChange(Maint_notify_status_t status)
@@ -2892,11 +4782,16 @@ namespace WPEFramework
             JsonObject params;
             /* we store the updated value as well */
             m_notify_status = status;
+            publishStatus();
+            if (status == MAINTENANCE_ERROR || status == MAINTENANCE_COMPLETE || status == MAINTENANCE_INCOMPLETE)
+            {
+                endHistoryCycle(status);
+            }
             params["maintenanceStatus"] = notifyStatusToString(status);
 
 			if (notifyStatusToString(m_notify_status) == "MAINTENANCE_INCOMPLETE")
 			{
-				t2_event_d("SYST_INFO_MaintnceIncmpl", 1);
+				Utils::Telemetry::batcher().count("SYST_INFO_MaintnceIncmpl");
 			}
 			
             sendNotify(EVT_ONMAINTENANCSTATUSCHANGE, params);
@@ -2905,5 +4800,16 @@ namespace WPEFramework
 #endif
         }
 
+        void MaintenanceManager::onMaintenanceStartTimeChanged(int start_time)
+        {
+            JsonObject params;
+            params["maintenanceStartTime"] = start_time;
+
+            sendNotify(EVT_ONMAINTENANCESTARTTIMECHANGED, params);
+#if defined(ENABLE_JOURNAL_LOGGING)
+            MM_SEND_NOTIFY(EVT_ONMAINTENANCESTARTTIMECHANGED, params);
+#endif
+        }
+
     } /* namespace Plugin */
 } /* namespace WPEFramework */
@@ -23,9 +23,15 @@
 #include <stdint.h>
 #include <thread>
 #include <map>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <time.h>
 #include <signal.h>
 #include <dirent.h>
+#include <sys/stat.h>
 
 #include "Module.h"
 #include "tracing/Logging.h"
@@ -37,8 +43,17 @@
 #include "sysMgr.h"
 #include "rfcapi.h"
 #include "cSettings.h"
+#include "UtilsRecordRing.h"
+#include "UtilsLatencyHistogram.h"
+#include "UtilsAsyncLog.h"
+#include "UtilsProcessIndex.h"
+#include "UtilsCgroup.h"
+#include "UtilsCheckpoint.h"
+#include "UtilsSpawn.h"
 
 #include <interfaces/IAuthService.h>
+#include <interfaces/IPowerManager.h>
+#include "PowerManagerInterface.h"
 
 /* ---- LOGGING ---- */
 #ifdef ENABLE_JOURNAL_LOGGING
@@ -46,12 +61,24 @@
 #define JOURNAL_IDENTIFIER "MaintenanceManager"
 #define MM_FILE_NAME "MaintenanceManager.cpp"
 
+#ifdef ENABLE_ASYNC_LOGGING
+static inline void mmJournalSink(int priority, const char *line)
+{
+    sd_journal_send("MESSAGE=%s", line, "PRIORITY=%i", priority, "SYSLOG_IDENTIFIER=%s", JOURNAL_IDENTIFIER, NULL);
+}
+
+/* Formatted on the caller's thread, sent to the journal by the Utils::AsyncLog writer once started */
+#define MM_LOG(priority, priority_str, format, ...)                                 \
+    Utils::AsyncLog::instance().log(mmJournalSink, priority, "%s [%s:%d] %s: " format, \
+                    priority_str, MM_FILE_NAME, __LINE__, __func__, ##__VA_ARGS__)
+#else
 #define MM_LOG(priority, priority_str, format, ...)                                 \
     sd_journal_send("MESSAGE=%s [%s:%d] %s: " format,                               \
                     priority_str, MM_FILE_NAME, __LINE__, __func__, ##__VA_ARGS__,  \
                     "PRIORITY=%i", priority,                                        \
                     "SYSLOG_IDENTIFIER=%s", JOURNAL_IDENTIFIER,                     \
                     NULL)
+#endif /* ENABLE_ASYNC_LOGGING */
 
 #define MM_LOGINFO(format, ...) MM_LOG(LOG_INFO, "INFO", format, ##__VA_ARGS__)
 #define MM_LOGWARN(format, ...) MM_LOG(LOG_WARNING, "WARN", format, ##__VA_ARGS__)
@@ -89,8 +116,13 @@
 /* MaintenanceManager Services Triggered Events. */
 #define EVT_ONMAINTMGRSAMPLEEVENT "onSampleEvent"
 #define EVT_ONMAINTENANCSTATUSCHANGE "onMaintenanceStatusChange" /* Maintenance Status change */
+#define EVT_ONMAINTENANCESTARTTIMECHANGED "onMaintenanceStartTimeChanged" /* Maintenance Start Time change */
 /* we have a persistant file to hold the record */
 #define MAINTENANCE_MGR_RECORD_FILE "/opt/maintenance_mgr_record.conf"
+/* ring buffer of the last MAINTENANCE_HISTORY_SIZE maintenance cycles */
+#define MAINTENANCE_MGR_HISTORY_FILE "/opt/maintenance_mgr_history.bin"
+/* progress of the cycle in progress, to resume it after a restart */
+#define MAINTENANCE_MGR_CHECKPOINT_FILE "/opt/maintenance_mgr_checkpoint.bin"
 
 typedef enum
 {
@@ -117,6 +149,40 @@ typedef enum
     UNSOLICITED_MAINTENANCE
 } Maintenance_Type_t;
 
+typedef enum
+{
+    TASK_OUTCOME_NOT_RUN,
+    TASK_OUTCOME_RUNNING,
+    TASK_OUTCOME_SUCCESS,
+    TASK_OUTCOME_ERROR,
+    TASK_OUTCOME_SKIPPED,
+    TASK_OUTCOME_TIMEOUT,
+    TASK_OUTCOME_ABORTED,
+    TASK_OUTCOME_RESUMED /* Completed before a restart interrupted the cycle */
+} Maint_task_outcome_t;
+
+/* Power state reported by org.rdk.PowerManager, as far as deferring tasks is concerned */
+typedef enum
+{
+    MAINT_POWER_UNKNOWN,
+    MAINT_POWER_ON,
+    MAINT_POWER_LIGHT_STANDBY,
+    MAINT_POWER_DEEP_STANDBY, /* In deep sleep or about to enter it */
+    MAINT_POWER_OFF
+} Maint_power_state_t;
+
+/* Phases of a maintenance cycle timed by getMaintenanceMetrics, tasks last in task order */
+typedef enum
+{
+    PHASE_ACTIVATION,
+    PHASE_WHOAMI,
+    PHASE_NETWORK,
+    PHASE_TASK_RFC,
+    PHASE_TASK_SWUPDATE,
+    PHASE_TASK_LOGUPLOAD,
+    MAX_MAINTENANCE_PHASES
+} Maint_phase_t;
+
 #define BASE_CLOCK CLOCK_BOOTTIME
 
 #define WHOAMI_PROP_KEY "WHOAMI_SUPPORT"
@@ -125,23 +191,52 @@ typedef enum
 #define FOREGROUND_MODE "FOREGROUND"
 #define BACKGROUND_MODE "BACKGROUND"
 
-#define TASKS_COMPLETED                 0x2A
-#define ALL_TASKS_SUCCESS               0x3F
 #define MAINTENANCE_TASK_SKIPPED        0x200
 
+#define INTERNET_CONNECTED_STATE        3
+#define INTERNET_UNKNOWN_STATE          -1
+#define NETWORK_RETRY_INTERVAL          30 /* Poll interval while not subscribed to onInternetStatusChange */
 #if defined(GTEST_ENABLE)
-#define MAX_NETWORK_RETRIES             1
+#define NETWORK_READY_TIMEOUT           0
 #else
-#define MAX_NETWORK_RETRIES             4
+#define NETWORK_READY_TIMEOUT           120 /* Seconds to wait for the device to come online */
 #endif
-#define INTERNET_CONNECTED_STATE        3
-#define NETWORK_RETRY_INTERVAL          30
-
-#define MAX_ACTIVATION_RETRIES          4
-#define SECMGR_RETRY_INTERVAL           5
 
-#define TASK_RETRY_COUNT                1
-#define TASK_RETRY_DELAY                5
+#if defined(GTEST_ENABLE)
+#define AUTHSERVICE_ACTIVATION_TIMEOUT  0
+#else
+#define AUTHSERVICE_ACTIVATION_TIMEOUT  40 /* Seconds to wait for org.rdk.AuthService to activate */
+#endif
+#define SECMGR_ACTIVATION_TIMEOUT       300 /* Seconds between logs while waiting for org.rdk.SecManager */
+#define PLUGIN_STATE_POLL_INTERVAL      10 /* Poll interval while plugin state notifications are unavailable */
+
+#define MAX_MAINTENANCE_TASKS           3
+#define DEFAULT_MAX_PARALLEL_TASKS      1
+#define DEFAULT_RESUME_WINDOW           21600 /* Seconds after its start an interrupted cycle is resumed, 0 never */
+#define POWER_MANAGER_CALLSIGN          "org.rdk.PowerManager"
+#define DEFAULT_MAX_DEFERRAL            7200 /* Seconds deferrable tasks are held while the device is in use, 0 never */
+#define DEFAULT_START_WINDOW            0 /* Seconds the start time of a device is spread over, 0 disables it */
+#define MAX_START_WINDOW                86400
+#define DEFAULT_DEVICE_ID_FILE          "/tmp/.estb_mac"
+
+#define MAX_TASK_EVENTS                 64 /* IARM_Maint_module_status_t values looked up in m_task_events */
+
+/* cgroup v2 group holding one child group per task, named after the task;
+ * off by default, as it must lie inside the group systemd delegates to WPEFramework */
+#define DEFAULT_CGROUP_ROOT             ""
+/* Limits of tasks started or running in BACKGROUND mode */
+#define CGROUP_BACKGROUND_CPU_WEIGHT    10
+#define CGROUP_BACKGROUND_IO_WEIGHT     10
+#define CGROUP_BACKGROUND_MEMORY_HIGH   (64 * 1024 * 1024) /* Bytes; reclaimed above, never killed */
+/* Kernel defaults, used in FOREGROUND mode */
+#define CGROUP_FOREGROUND_CPU_WEIGHT    100
+#define CGROUP_FOREGROUND_IO_WEIGHT     100
+
+#define TASK_EXIT_GRACE                 30 /* Seconds a task may take to report completion after exiting */
+#define TASK_KILL_WAIT_MS               1000 /* Milliseconds to wait for a killed task to exit */
+#define TASK_RETRY_COUNT                1   /* Default retries of a failed task invocation */
+#define TASK_RETRY_DELAY                5   /* Default seconds before the first retry, doubled for each further one */
+#define TASK_RETRY_DELAY_MAX            300 /* Default cap of the retry delay in seconds */
 #ifndef TASK_TIMEOUT
 #define TASK_TIMEOUT                    3600 /* Default Task Timeout (1 Hour i.e. 3600 seconds)  */
 #endif
@@ -158,10 +253,41 @@ typedef enum
 
 #define BUFFER_SIZE                     50
 
+#define MAINTENANCE_HISTORY_SIZE        64 /* Cycles kept in MAINTENANCE_MGR_HISTORY_FILE */
+#define MAINTENANCE_HISTORY_MAX_PAGE    16 /* Cycles returned by one getMaintenanceHistory call */
+
 #define SET_STATUS(VALUE, N) ((VALUE) |= (1 << (N)))
 #define CLEAR_STATUS(VALUE, N) ((VALUE) &= ~(1 << (N)))
 #define CHECK_STATUS(VALUE, N) ((VALUE) & (1 << (N)))
 
+/* A maintenance task; the built-in ones can be changed through the "tasks" configuration */
+typedef struct
+{
+    std::string name;                           /* Argument of the task script, also names the task in the API */
+    std::string command;                        /* Started by launchTask() */
+    std::string processName;                    /* Found in /proc to abort a task started elsewhere */
+    IARM_Maint_module_status_t completeEvent;
+    IARM_Maint_module_status_t errorEvent;
+    IARM_Maint_module_status_t inProgressEvent; /* The task was started outside the plugin */
+    uint8_t successBit;                         /* Bits of g_task_status */
+    uint8_t completeBit;
+    uint8_t dependencies;                       /* Tasks that must complete first, as a bitmask of task ids */
+    uint8_t priority;                           /* Lower starts first among tasks that may start */
+    uint8_t attempts;                           /* Invocations before a task that cannot be started is set to error */
+    int timeout;                                /* Seconds before the task is set to error */
+    int retryDelay;                             /* Seconds before the first retry, doubled for each further one */
+    int retryDelayMax;                          /* Cap of the retry delay in seconds */
+    bool deferrable;                            /* Held while the device is in use, see deferTask() */
+} Maint_task_definition_t;
+
+typedef enum
+{
+    TASK_EVENT_NONE,
+    TASK_EVENT_COMPLETE,
+    TASK_EVENT_ERROR,
+    TASK_EVENT_INPROGRESS
+} Maint_task_event_t;
+
 namespace WPEFramework
 {
     namespace Plugin
@@ -183,6 +309,215 @@ namespace WPEFramework
 
         class MaintenanceManager : public PluginHost::IPlugin, public PluginHost::JSONRPC
         {
+        private:
+            /* Tracks the plugins MaintenanceManager depends on being activated */
+            class PluginStateNotification : public PluginHost::IPlugin::INotification
+            {
+            public:
+                explicit PluginStateNotification(MaintenanceManager *parent)
+                    : _parent(*parent)
+                {
+                    ASSERT(parent != nullptr);
+                }
+
+                ~PluginStateNotification() override
+                {
+                }
+
+                PluginStateNotification() = delete;
+                PluginStateNotification(const PluginStateNotification &) = delete;
+                PluginStateNotification &operator=(const PluginStateNotification &) = delete;
+
+#ifdef USE_THUNDER_R4
+                void Activated(const string &callsign, PluginHost::IShell *) override
+                {
+                    _parent.onPluginStateChange(callsign, true);
+                }
+
+                void Deactivated(const string &callsign, PluginHost::IShell *) override
+                {
+                    _parent.onPluginStateChange(callsign, false);
+                }
+
+                void Unavailable(const string &callsign, PluginHost::IShell *) override
+                {
+                    _parent.onPluginStateChange(callsign, false);
+                }
+#else
+                void StateChange(PluginHost::IShell *plugin, const string &callsign) override
+                {
+                    _parent.onPluginStateChange(callsign, plugin->State() == PluginHost::IShell::state::ACTIVATED);
+                }
+#endif /* USE_THUNDER_R4 */
+
+                BEGIN_INTERFACE_MAP(PluginStateNotification)
+                INTERFACE_ENTRY(PluginHost::IPlugin::INotification)
+                END_INTERFACE_MAP
+
+            private:
+                MaintenanceManager &_parent;
+            };
+
+            /* Power mode changes of org.rdk.PowerManager, which hold deferrable tasks */
+            class PowerModeNotification : public Exchange::IPowerManager::IModeChangedNotification,
+                                          public Exchange::IPowerManager::IModePreChangeNotification
+            {
+            public:
+                explicit PowerModeNotification(MaintenanceManager *parent)
+                    : _parent(*parent)
+                {
+                    ASSERT(parent != nullptr);
+                }
+
+                ~PowerModeNotification() override
+                {
+                }
+
+                PowerModeNotification() = delete;
+                PowerModeNotification(const PowerModeNotification &) = delete;
+                PowerModeNotification &operator=(const PowerModeNotification &) = delete;
+
+                void OnPowerModeChanged(const Exchange::IPowerManager::PowerState /* currentState */, const Exchange::IPowerManager::PowerState newState) override
+                {
+                    _parent.onPowerModeChanged(newState);
+                }
+
+                void OnPowerModePreChange(const Exchange::IPowerManager::PowerState /* currentState */, const Exchange::IPowerManager::PowerState newState,
+                                          const int /* transactionId */, const int /* stateChangeAfter */) override
+                {
+                    _parent.onPowerModePreChange(newState);
+                }
+
+                BEGIN_INTERFACE_MAP(PowerModeNotification)
+                INTERFACE_ENTRY(Exchange::IPowerManager::IModeChangedNotification)
+                INTERFACE_ENTRY(Exchange::IPowerManager::IModePreChangeNotification)
+                END_INTERFACE_MAP
+
+            private:
+                MaintenanceManager &_parent;
+            };
+
+            /* Overrides the built-in definition of the task with the same name; unset fields keep theirs */
+            class TaskConfig : public Core::JSON::Container
+            {
+            public:
+                TaskConfig()
+                    : Core::JSON::Container()
+                {
+                    Init();
+                }
+
+                TaskConfig(const TaskConfig &copy)
+                    : Core::JSON::Container()
+                    , Name(copy.Name)
+                    , Command(copy.Command)
+                    , Process(copy.Process)
+                    , CompleteEvent(copy.CompleteEvent)
+                    , ErrorEvent(copy.ErrorEvent)
+                    , InProgressEvent(copy.InProgressEvent)
+                    , Timeout(copy.Timeout)
+                    , Priority(copy.Priority)
+                    , Attempts(copy.Attempts)
+                    , RetryDelay(copy.RetryDelay)
+                    , RetryDelayMax(copy.RetryDelayMax)
+                    , Deferrable(copy.Deferrable)
+                {
+                    Init();
+                }
+
+                TaskConfig &operator=(const TaskConfig &rhs)
+                {
+                    Name = rhs.Name;
+                    Command = rhs.Command;
+                    Process = rhs.Process;
+                    CompleteEvent = rhs.CompleteEvent;
+                    ErrorEvent = rhs.ErrorEvent;
+                    InProgressEvent = rhs.InProgressEvent;
+                    Timeout = rhs.Timeout;
+                    Priority = rhs.Priority;
+                    Attempts = rhs.Attempts;
+                    RetryDelay = rhs.RetryDelay;
+                    RetryDelayMax = rhs.RetryDelayMax;
+                    Deferrable = rhs.Deferrable;
+                    return (*this);
+                }
+
+                ~TaskConfig() override
+                {
+                }
+
+                Core::JSON::String Name;             // RFC, SWUPDATE or LOGUPLOAD
+                Core::JSON::String Command;          // Program and arguments split at whitespace, without a shell: no quoting or escaping
+                Core::JSON::String Process;          // Name found in /proc when aborting a task started elsewhere
+                Core::JSON::DecUInt8 CompleteEvent;  // IARM_Maint_module_status_t reporting success
+                Core::JSON::DecUInt8 ErrorEvent;     // IARM_Maint_module_status_t reporting failure
+                Core::JSON::DecUInt8 InProgressEvent; // IARM_Maint_module_status_t reporting a run started elsewhere
+                Core::JSON::DecUInt32 Timeout;       // Seconds before the task is set to error
+                Core::JSON::DecUInt8 Priority;       // Lower starts first among tasks that may start
+                Core::JSON::DecUInt8 Attempts;       // Invocations before a task that cannot be started is set to error
+                Core::JSON::DecUInt32 RetryDelay;    // Seconds before the first retry, doubled for each further one
+                Core::JSON::DecUInt32 RetryDelayMax; // Cap of the retry delay in seconds
+                Core::JSON::Boolean Deferrable;      // Held during playback or deep sleep, up to maxdeferral seconds
+
+            private:
+                void Init()
+                {
+                    Add(_T("name"), &Name);
+                    Add(_T("command"), &Command);
+                    Add(_T("process"), &Process);
+                    Add(_T("completeevent"), &CompleteEvent);
+                    Add(_T("errorevent"), &ErrorEvent);
+                    Add(_T("inprogressevent"), &InProgressEvent);
+                    Add(_T("timeout"), &Timeout);
+                    Add(_T("priority"), &Priority);
+                    Add(_T("attempts"), &Attempts);
+                    Add(_T("retrydelay"), &RetryDelay);
+                    Add(_T("retrydelaymax"), &RetryDelayMax);
+                    Add(_T("deferrable"), &Deferrable);
+                }
+            };
+
+            class Config : public Core::JSON::Container
+            {
+            public:
+                Config()
+                    : Core::JSON::Container()
+                    , MaxParallelTasks(DEFAULT_MAX_PARALLEL_TASKS) // Number of independent tasks allowed to run at once
+                    , CgroupRoot(_T(DEFAULT_CGROUP_ROOT)) // Empty to leave tasks in the plugin's cgroup
+                    , BackgroundIoMax() // io.max line for BACKGROUND mode, e.g. "179:0 wbps=8388608"
+                    , Tasks() // Changes to the built-in task definitions
+                    , ResumeWindow(DEFAULT_RESUME_WINDOW) // Seconds after its start an interrupted cycle is resumed
+                    , StartWindow(DEFAULT_START_WINDOW) // Seconds the start time is spread over across devices
+                    , DeviceIdFile(_T(DEFAULT_DEVICE_ID_FILE)) // File holding the identifier the spread is derived from
+                    , MaxDeferral(DEFAULT_MAX_DEFERRAL) // Seconds deferrable tasks are held while the device is in use
+                {
+                    Add(_T("maxparalleltasks"), &MaxParallelTasks);
+                    Add(_T("cgrouproot"), &CgroupRoot);
+                    Add(_T("backgroundiomax"), &BackgroundIoMax);
+                    Add(_T("tasks"), &Tasks);
+                    Add(_T("resumewindow"), &ResumeWindow);
+                    Add(_T("startwindow"), &StartWindow);
+                    Add(_T("deviceidfile"), &DeviceIdFile);
+                    Add(_T("maxdeferral"), &MaxDeferral);
+                }
+
+                ~Config() override
+                {
+                }
+
+                Config(const Config &) = delete;
+                Config &operator=(const Config &) = delete;
+
+                Core::JSON::DecUInt8 MaxParallelTasks;
+                Core::JSON::String CgroupRoot;
+                Core::JSON::String BackgroundIoMax;
+                Core::JSON::ArrayType<TaskConfig> Tasks;
+                Core::JSON::DecUInt32 ResumeWindow;
+                Core::JSON::DecUInt32 StartWindow;
+                Core::JSON::String DeviceIdFile;
+                Core::JSON::DecUInt32 MaxDeferral;
+            };
+
 #if defined(GTEST_ENABLE)
         public:
 #else
@@ -192,6 +527,45 @@ namespace WPEFramework
             typedef Core::JSON::ArrayType<JString> JStringArray;
             typedef Core::JSON::Boolean JBool;
 
+            /* Immutable view of the maintenance status served by getMaintenanceActivityStatus */
+            struct StatusSnapshot
+            {
+                uint32_t version;
+                Maint_notify_status_t status;
+                int lastSuccessfulCompletionTime;
+                bool isCriticalMaintenance;
+                bool isRebootPending;
+            };
+
+            /* One maintenance cycle in MAINTENANCE_MGR_HISTORY_FILE; times are epoch seconds */
+            struct HistoryRecord
+            {
+                int64_t startTime;
+                int64_t endTime;
+                uint32_t networkWaitMs;
+                uint8_t type;   /* Maintenance_Type_t */
+                uint8_t status; /* Maint_notify_status_t */
+                uint8_t reserved[2];
+                struct
+                {
+                    int64_t startTime;
+                    int64_t endTime;
+                    uint8_t outcome; /* Maint_task_outcome_t */
+                    uint8_t attempts;
+                    uint8_t reserved[6];
+                } tasks[MAX_MAINTENANCE_TASKS];
+            };
+
+            /* The cycle in MAINTENANCE_MGR_CHECKPOINT_FILE; rewritten only when a task succeeds */
+            struct CycleCheckpoint
+            {
+                int64_t startTime; /* Identifies the cycle; epoch seconds */
+                uint8_t open;      /* 0 once the maintenance thread is done with the cycle */
+                uint8_t type;      /* Maintenance_Type_t */
+                uint8_t done;      /* Tasks that succeeded, as a bitmask of task ids */
+                uint8_t reserved[5];
+            };
+
             // TODO: make them all static as they are shared across all instances (It is a singleton anyway)
             string g_currentMode;
             string g_triggerMode;
@@ -202,20 +576,57 @@ namespace WPEFramework
 
             IARM_Bus_MaintMGR_EventData_t *g_maintenance_data;
             Maint_notify_status_t m_notify_status;
+            /* Replaced as a whole by publishStatus(), read with std::atomic_load() */
+            std::shared_ptr<const StatusSnapshot> m_status_snapshot;
+            uint32_t m_status_version;
+
+            /* History of maintenance cycles; m_cycle is the one in progress */
+            Utils::RecordRing m_history;
+            std::mutex m_historyMutex;
+            HistoryRecord m_cycle;
+            bool m_cycle_open;
+            /* Progress of the cycle, kept across restarts; used by the maintenance thread only */
+            Utils::Checkpoint m_checkpoint;
+            int64_t m_checkpoint_start; /* Start time of the cycle being checkpointed */
+            uint32_t m_resume_window;
+            std::atomic<bool> m_deinitializing; /* Keeps the checkpoint of a cycle stopped by Deinitialize() open */
+            /* Phase latencies in milliseconds; m_task_started is guarded by m_historyMutex */
+            Utils::LatencyHistogram m_phase_latency[MAX_MAINTENANCE_PHASES];
+            std::chrono::steady_clock::time_point m_task_started[MAX_MAINTENANCE_TASKS];
+            /* Microseconds iarmEventHandler() holds m_statusMutex per event */
+            Utils::LatencyHistogram m_event_lock_hold;
             Maintenance_Type_t g_maintenance_type;
             static cSettings m_setting;
+            /* softwareoptout as last written or read, for getMaintenanceMode(); m_optout_stat
+             * identifies the record file it came from, so a file replaced by others is re-read */
+            std::mutex m_optoutMutex;
+            string m_optout;
+            struct stat m_optout_stat;
             bool m_abort_flag;
-            uint16_t g_task_status;
+            std::atomic<uint16_t> g_task_status; /* Set by the maintenance thread and by event handlers */
+            uint8_t m_max_parallel_tasks;
             bool g_unsolicited_complete;
             bool g_listen_to_nwevents = false;
             bool g_subscribed_for_nwevents = false;
             bool g_listen_to_deviceContextUpdate = false;
             bool g_subscribed_for_deviceContextUpdate = false;
             bool g_whoami_support_enabled = false;
+            /* Whether the device is in use, set from PowerManager events and setPlaybackState */
+            std::atomic<uint8_t> m_power_state;
+            std::atomic<bool> m_playback_active;
+            std::atomic<bool> m_power_subscribed;
+            uint32_t m_max_deferral;
 #if defined(SUPPRESS_MAINTENANCE)
             bool g_suppress_maintenance_enabled = true;
 #else
             bool g_suppress_maintenance_enabled = false;
+#endif
+#if defined(GTEST_ENABLE)
+            /* Set by tests that report task results as IARM events, as the task scripts do */
+            bool m_wait_for_task_events = false;
+            /* Started in place of the task process when set: returns 0 or an errno,
+             * and a descriptor that becomes readable when the task has exited */
+            std::function<int(int task_index, int &exit_fd)> m_spawn_stub;
 #endif
             std::mutex m_callMutex;
             std::mutex m_waiMutex;
@@ -223,15 +634,129 @@ namespace WPEFramework
             std::condition_variable task_thread;
             std::thread m_thread;
 
-            std::map<string, bool> m_task_map;
+            /* The task registry, indexed by TaskIndices */
+            Maint_task_definition_t m_tasks[MAX_MAINTENANCE_TASKS];
+            /* Task and kind of each status event of m_tasks, indexed by IARM_Maint_module_status_t */
+            struct
+            {
+                int8_t task;
+                uint8_t kind; /* Maint_task_event_t */
+            } m_task_events[MAX_TASK_EVENTS];
+            uint16_t m_tasks_completed_mask; /* Complete bits of every task */
+            uint16_t m_tasks_success_mask;   /* Success and complete bits of every task */
+            /* Started and not yet reported, indexed by TaskIndices. Event handlers
+             * check and clear it with m_statusMutex held; the maintenance thread sets
+             * it without, as stopMaintenanceTasks() joins that thread holding the mutex */
+            std::atomic<bool> m_task_active[MAX_MAINTENANCE_TASKS];
+
+            /* Process started by launchTask() for each task, indexed by TaskIndices */
+            struct TaskProcess
+            {
+                pid_t pid;
+                int pidfd;
+                bool inCgroup;              /* started in its group of m_cgroup */
+                Utils::CgroupUsage cgroupBase; /* what the group had used before, for a group that could not be removed */
+            };
+            TaskProcess m_task_process[MAX_MAINTENANCE_TASKS];
+            std::mutex m_processMutex;
+            /* Resources used by the last run of each task and number of runs; guarded by m_processMutex */
+            Utils::ProcessUsage m_task_usage[MAX_MAINTENANCE_TASKS];
+            uint32_t m_task_runs[MAX_MAINTENANCE_TASKS];
+            /* One cgroup per task, limited while in BACKGROUND mode; guarded by m_processMutex */
+            Utils::Cgroup m_cgroup;
+            bool m_task_background;
+            string m_background_io_max;
             std::map<string, string> m_param_map;
             std::map<string, DATA_TYPE> m_paramType_map;
 
             PluginHost::IShell *m_service = nullptr;
             Exchange::IAuthService *m_authservicePlugin;
 
-            bool isDeviceOnline();
+            /* Task supervisor, see startTaskSupervisor() */
+            int m_epoll_fd;
+            int m_wakeup_fd;
+            int m_cycle_fd; /* see requestCycleCheck() */
+            int m_task_timerfd[MAX_MAINTENANCE_TASKS];
+            std::thread m_supervisor_thread;
+            /* PIDs of the task binaries, kept current from process connector events */
+            Utils::ProcessIndex m_process_index;
+
+            /* Cached maintenance start time, kept current by the supervisor */
+            int m_inotify_fd;
+            int m_start_timerfd;
+            std::mutex m_startTimeMutex;
+            int m_maintenance_start_time;
+            bool m_start_time_cached;
+            uint32_t m_start_jitter; /* Seconds this device starts after the configured time */
+
+            /* JSON-RPC links to other plugins, kept open and shared by callsign */
+            std::mutex m_linkMutex;
+            std::map<string, std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>>> m_thunder_links;
+            uint32_t m_link_creations;
+            uint32_t m_link_reuses;
+
+            /* Last known onInternetStatusChange state, INTERNET_UNKNOWN_STATE until reported */
+            std::mutex m_networkMutex;
+            std::condition_variable m_network_cv;
+            int m_internet_state;
+
+            /* Activation state of other plugins as reported to m_pluginStateSink */
+            Core::Sink<PluginStateNotification> m_pluginStateSink;
+            bool m_pluginStateRegistered;
+            std::mutex m_pluginStateMutex;
+            std::condition_variable m_pluginState_cv;
+            std::map<string, bool> m_plugin_activated;
+
+            /* org.rdk.PowerManager and the sink of its notifications, see subscribeToPowerStateEvents() */
+            PowerManagerInterfaceRef m_powerManager;
+            Core::Sink<PowerModeNotification> m_powerModeSink;
+
+            void publishStatus();
+            void beginHistoryCycle();
+            void recordNetworkWait(uint32_t wait_ms);
+            uint32_t recordPhase(Maint_phase_t phase, std::chrono::steady_clock::time_point start);
+            void recordTaskOutcome(int task_index, Maint_task_outcome_t outcome);
+            void endHistoryCycle(Maint_notify_status_t status);
+            uint8_t resumeCycle();
+            void saveCheckpoint(bool open);
+            bool isDeviceOnline(int timeout = NETWORK_READY_TIMEOUT);
+            void setInternetState(int state);
+            void onPluginStateChange(const string &callsign, bool activated);
+            bool waitForPluginActivation(const string &callsign, int timeout);
             void task_execution_thread();
+            bool launchTask(int task_index);
+            void failTask(int task_index);
+            bool endCycleIfComplete();
+            void requestCycleCheck();
+            std::chrono::milliseconds retryDelay(int task_index, int attempt) const;
+            Utils::CgroupLimits cgroupLimits(bool background) const;
+            void applyTaskLimits(bool background);
+            void loadTaskRegistry(const Core::JSON::ArrayType<TaskConfig> &overrides);
+            bool lookupTaskEvent(IARM_Maint_module_status_t status, int &task_index, Maint_task_event_t &kind) const;
+            void reportTaskUsage(int task_index, const Utils::ProcessUsage &usage);
+            bool taskDependenciesCompleted(int task_index);
+            bool anyTaskCompleted(const std::vector<int> &running);
+            void wakeTaskThread();
+            bool deviceInUse() const;
+            bool deferTask(int task_index) const;
+            void onDeviceUseChanged();
+            bool reapTask(int task_index, bool release = false);
+            int signalTask(int task_index, int sig = SIGABRT);
+            bool killTask(int task_index);
+            bool startTaskSupervisor();
+            void stopTaskSupervisor();
+            void task_supervisor_thread();
+            bool task_startTimer(int task_index, int timeout = TASK_TIMEOUT);
+            bool task_stopTimer(int task_index);
+            bool task_stopAllTimers();
+            void onTaskTimeout(int task_index);
+            void onTaskExit(int task_index);
+            bool startTimeFilesChanged();
+            void loadStartTimeJitter(const string& device_id_file, uint32_t window);
+            int refreshMaintenanceStartTime();
+            int getCachedMaintenanceStartTime();
+            void cacheOptOut(const string &optout);
+            bool readOptOut(string &optout);
             void requestSystemReboot();
             void maintenanceManagerOnBootup();
             bool checkAutoRebootFlag();
@@ -239,6 +764,8 @@ namespace WPEFramework
             bool setRFC(const char *, const char *, DATA_TYPE);
             void setPartnerId(string);
             WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement> *getThunderPluginHandle(const char *);
+            std::shared_ptr<WPEFramework::JSONRPC::LinkType<WPEFramework::Core::JSON::IElement>> getThunderLink(const string &callsign);
+            void dropThunderLink(const string &callsign, uint32_t status);
             bool stopMaintenanceTasks();
             bool subscribeForInternetStatusEvent(string);
             void internetStatusChangeEventHandler(const JsonObject &parameters);
@@ -248,6 +775,10 @@ namespace WPEFramework
             bool isWhoAmIEnabled();
             bool knowWhoAmI(string &activation_status);
             bool subscribeToDeviceInitializationEvent();
+            bool subscribeToPowerStateEvents();
+            void unsubscribeFromPowerStateEvents();
+            void onPowerModeChanged(Exchange::IPowerManager::PowerState state);
+            void onPowerModePreChange(Exchange::IPowerManager::PowerState state);
             bool setDeviceInitializationContext(JsonObject joGetResult);
             bool getActivatedStatus(bool &skipFirmwareCheck);
             const string checkActivatedStatus(void);
@@ -282,22 +813,11 @@ namespace WPEFramework
             virtual string Information() const override { return {}; }
             static int runScript(const std::string &script, const std::string &args, string *output = NULL, string *error = NULL, int timeout = 30000);
 
-            /* Timer Implementations */
-            static void timer_handler(int signo);
-            static timer_t timerid;
-            static string currentTask;
-            static bool g_task_timerCreated;
-
-            bool maintenance_initTimer();
-            bool task_startTimer();
-            bool task_stopTimer();
-            bool maintenance_deleteTimer();
-
             /* ---- Accessors ---- */
             bool testSetRFC(const char *rfc, const char *value, DATA_TYPE dataType) { return setRFC(rfc, value, dataType); }
             bool testReadRFC(const char *rfc) { return readRFC(rfc); }
             Maint_notify_status_t getNotifyStatus() { return m_notify_status; }
-            void setNotifyStatus(Maint_notify_status_t status) { m_notify_status = status; }
+            void setNotifyStatus(Maint_notify_status_t status) { m_notify_status = status; publishStatus(); }
             void testStartCriticalTasks() { startCriticalTasks(); }
             pid_t callGetTaskPID(const char *taskname) { return getTaskPID(taskname); }
             void callInternetStatusChangeEventHandler(const JsonObject &parameters) { internetStatusChangeEventHandler(parameters); }
@@ -322,6 +842,7 @@ namespace WPEFramework
 #endif
             /* Events */
             void onMaintenanceStatusChange(Maint_notify_status_t status);
+            void onMaintenanceStartTimeChanged(int start_time);
 
             /* Methods */
 #ifdef DEBUG
@@ -334,6 +855,10 @@ namespace WPEFramework
             uint32_t startMaintenance(const JsonObject &parameters, JsonObject &response);
             uint32_t stopMaintenance(const JsonObject &parameters, JsonObject &response);
             uint32_t getMaintenanceMode(const JsonObject &parameters, JsonObject &response);
+            uint32_t getMaintenanceHistory(const JsonObject &parameters, JsonObject &response);
+            uint32_t getMaintenanceMetrics(const JsonObject &parameters, JsonObject &response);
+            uint32_t setTaskPolicy(const JsonObject &parameters, JsonObject &response);
+            uint32_t setPlaybackState(const JsonObject &parameters, JsonObject &response);
         }; /* end of MaintenanceManager service class */
     } /* end of plugin */
 } /* end of wpeframework */
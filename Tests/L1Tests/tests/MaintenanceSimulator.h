@@ -0,0 +1,581 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+/*
+ * Drives maintenance cycles through a MaintenanceManager without IARM,
+ * Thunder or the RDK task scripts, to benchmark and regression-test the
+ * cycle state machine on a build host. Include after MaintenanceManager.cpp.
+ *
+ * Each cycle runs the plugin's own task_execution_thread(), so the
+ * scheduler, the parallel limit, the retries and the deferral of tasks are
+ * the ones the device runs. By default the tasks are not processes: the
+ * plugin starts them through m_spawn_stub, and once a task's time is up the
+ * simulator injects the IARM event the task script would broadcast into
+ * _MaintenanceMgrEventHandler and signals its exit descriptor, which the
+ * task supervisor handles as it does a pidfd. Cycles of tasks that take no
+ * time run back to back at thousands per second. With SPAWNED_TASKS the
+ * plugin spawns a fake Start_MaintenanceTasks.sh instead, which sleeps and
+ * exits as configured and leaves its exit code in a file for the simulator
+ * to report, to cover the spawn and cgroup path at the cost of a process
+ * per task. The plugins the cycle talks to are stood in for by events as
+ * well: the device is reported online through setInternetState(), and
+ * PowerManager is taken as subscribed, so tests set the device in use
+ * through m_playback_active or the power events.
+ *
+ * replay() feeds a recorded event trace to the handler instead, to measure
+ * what each event costs; see loadTrace() for the format.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <ftw.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+
+#include "UtilsLatencyHistogram.h"
+
+class MaintenanceSimulator
+{
+public:
+    struct TaskConfig
+    {
+        uint32_t durationMs; /* time the task runs */
+        int exitCode;        /* 0 reports completion, anything else reports an error */
+        bool aborted;        /* SWUPDATE only: report MAINT_FWDOWNLOAD_ABORTED instead */
+        bool launchFails;    /* the task cannot be started, so the scheduler retries it */
+    };
+
+    struct Result
+    {
+        uint32_t cycles;
+        uint32_t complete;
+        uint32_t incomplete;
+        uint32_t error;
+        double cyclesPerSecond;
+    };
+
+    /* How the tasks of a cycle run */
+    enum Mode
+    {
+        SIMULATED_TASKS, /* started through m_spawn_stub, no process */
+        SPAWNED_TASKS    /* a fake task script the plugin spawns */
+    };
+
+    explicit MaintenanceSimulator(WPEFramework::Plugin::MaintenanceManager& plugin, Mode mode = SIMULATED_TASKS)
+        : _plugin(plugin)
+        , _mode(mode)
+        , _stopping(false)
+        , _whoami(plugin.g_whoami_support_enabled)
+        , _suppress(plugin.g_suppress_maintenance_enabled)
+        , _nwevents(plugin.g_subscribed_for_nwevents)
+        , _powerSubscribed(plugin.m_power_subscribed)
+    {
+        for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+        {
+            _tasks[i] = TaskConfig{ 0, 0, false, false };
+            _realCommands[i] = _plugin.m_tasks[i].command;
+        }
+        /* no WhoAmI or activation check, the network and PowerManager report through events */
+        _plugin.g_whoami_support_enabled = false;
+        _plugin.g_suppress_maintenance_enabled = false;
+        _plugin.g_subscribed_for_nwevents = true;
+        _plugin.m_power_subscribed = true;
+        _plugin.m_wait_for_task_events = true;
+        if (_mode == SPAWNED_TASKS)
+        {
+            char dir[] = "/tmp/MaintenanceSimulator.XXXXXX";
+            if (mkdtemp(dir) != nullptr)
+            {
+                _dir = dir;
+            }
+            writeTaskScript();
+            for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+            {
+                setCommand(i);
+            }
+        }
+        else
+        {
+            _plugin.m_spawn_stub = [this](int task_index, int& exit_fd) { return startTask(task_index, exit_fd); };
+        }
+        _pump = std::thread(&MaintenanceSimulator::pumpEvents, this);
+    }
+
+    ~MaintenanceSimulator()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_pumpMutex);
+            _stopping = true;
+        }
+        _pumpCv.notify_one();
+        _pump.join();
+        for (const Exit& exit : _exits)
+        {
+            close(exit.fd);
+        }
+        _plugin.m_spawn_stub = nullptr;
+        for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+        {
+            _plugin.m_tasks[i].command = _realCommands[i];
+        }
+        _plugin.m_wait_for_task_events = false;
+        _plugin.m_power_subscribed = _powerSubscribed;
+        _plugin.g_subscribed_for_nwevents = _nwevents;
+        _plugin.g_suppress_maintenance_enabled = _suppress;
+        _plugin.g_whoami_support_enabled = _whoami;
+        if (!_dir.empty())
+        {
+            nftw(_dir.c_str(), [](const char* path, const struct stat*, int, struct FTW*) { return remove(path); },
+                16, FTW_DEPTH | FTW_PHYS);
+        }
+    }
+
+    MaintenanceSimulator(const MaintenanceSimulator&) = delete;
+    MaintenanceSimulator& operator=(const MaintenanceSimulator&) = delete;
+
+    void setTask(int task_index, const TaskConfig& config)
+    {
+        _tasks[task_index] = config;
+        if (_mode == SPAWNED_TASKS)
+        {
+            writeTaskScript();
+            setCommand(task_index);
+        }
+    }
+
+    /**
+     * @brief Run cycles back to back, recording how long each one takes in microseconds
+     */
+    Result run(uint32_t cycles)
+    {
+        Result result = {};
+        auto begin = std::chrono::steady_clock::now();
+        for (uint32_t cycle = 0; cycle < cycles; cycle++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            Maint_notify_status_t status = runCycle();
+            _cycleTime.record((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+            result.cycles++;
+            if (status == MAINTENANCE_COMPLETE)
+                result.complete++;
+            else if (status == MAINTENANCE_INCOMPLETE)
+                result.incomplete++;
+            else
+                result.error++;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        result.cyclesPerSecond = (seconds > 0) ? (result.cycles / seconds) : 0;
+        return result;
+    }
+
+    const Utils::LatencyHistogram& cycleTime() const
+    {
+        return _cycleTime;
+    }
+
+    void report(const char* name, const Result& result) const
+    {
+        printf("[ SIMULATE ] %s: %u cycles (%u complete, %u incomplete, %u error), %.0f cycles/s, "
+               "cycle time us p50=%u p95=%u p99=%u max=%u\n",
+            name, result.cycles, result.complete, result.incomplete, result.error, result.cyclesPerSecond,
+            _cycleTime.percentile(50), _cycleTime.percentile(95), _cycleTime.percentile(99), _cycleTime.max());
+    }
+
+    /* One line of an event trace: the start of a cycle, or a status broadcast by a task */
+    struct TraceEvent
+    {
+        bool start;
+        IARM_Maint_module_status_t status;
+    };
+
+    /**
+     * @brief Read an event trace
+     *
+     * One event per line: START, which starts a cycle with every task
+     * running, or a status by its IARM_Maint_module_status_t name or number,
+     * so a trace can be cut from the "MaintMGR Status <n>" lines the plugin
+     * logs. Text after '#' is ignored.
+     *
+     * @return false if the file cannot be read or a line is not understood
+     */
+    static bool loadTrace(const std::string& path, std::vector<TraceEvent>& trace)
+    {
+        static const struct
+        {
+            const char* name;
+            IARM_Maint_module_status_t status;
+        } names[] = {
+            { "MAINT_RFC_COMPLETE", MAINT_RFC_COMPLETE },
+            { "MAINT_RFC_ERROR", MAINT_RFC_ERROR },
+            { "MAINT_RFC_INPROGRESS", MAINT_RFC_INPROGRESS },
+            { "MAINT_FWDOWNLOAD_COMPLETE", MAINT_FWDOWNLOAD_COMPLETE },
+            { "MAINT_FWDOWNLOAD_ERROR", MAINT_FWDOWNLOAD_ERROR },
+            { "MAINT_FWDOWNLOAD_ABORTED", MAINT_FWDOWNLOAD_ABORTED },
+            { "MAINT_FWDOWNLOAD_INPROGRESS", MAINT_FWDOWNLOAD_INPROGRESS },
+            { "MAINT_LOGUPLOAD_COMPLETE", MAINT_LOGUPLOAD_COMPLETE },
+            { "MAINT_LOGUPLOAD_ERROR", MAINT_LOGUPLOAD_ERROR },
+            { "MAINT_LOGUPLOAD_INPROGRESS", MAINT_LOGUPLOAD_INPROGRESS },
+            { "MAINT_REBOOT_REQUIRED", MAINT_REBOOT_REQUIRED },
+            { "MAINT_CRITICAL_UPDATE", MAINT_CRITICAL_UPDATE },
+        };
+
+        std::ifstream file(path);
+        if (!file)
+        {
+            return false;
+        }
+        std::string line;
+        while (std::getline(file, line))
+        {
+            line = line.substr(0, line.find('#'));
+            size_t begin = line.find_first_not_of(" \t\r");
+            if (begin == std::string::npos)
+            {
+                continue;
+            }
+            std::string word = line.substr(begin, line.find_last_not_of(" \t\r") + 1 - begin);
+
+            TraceEvent event = { false, (IARM_Maint_module_status_t)0 };
+            bool known = false;
+            if (word == "START")
+            {
+                event.start = known = true;
+            }
+            for (const auto& entry : names)
+            {
+                if (word == entry.name)
+                {
+                    event.status = entry.status;
+                    known = true;
+                }
+            }
+            char* end = nullptr;
+            long number = strtol(word.c_str(), &end, 10);
+            if (!known && *end == '\0')
+            {
+                event.status = (IARM_Maint_module_status_t)number;
+                known = true;
+            }
+            if (!known)
+            {
+                return false;
+            }
+            trace.push_back(event);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Replay a trace repeat times, recording how long each event takes to handle in microseconds
+     */
+    void replay(const std::vector<TraceEvent>& trace, uint32_t repeat)
+    {
+        for (uint32_t i = 0; i < repeat; i++)
+        {
+            for (const TraceEvent& event : trace)
+            {
+                if (event.start)
+                {
+                    startCycle();
+                    for (int task_index = 0; task_index < MAX_MAINTENANCE_TASKS; task_index++)
+                    {
+                        _plugin.m_task_active[task_index] = true;
+                        _plugin.recordTaskOutcome(task_index, TASK_OUTCOME_RUNNING);
+                    }
+                    continue;
+                }
+                auto start = std::chrono::steady_clock::now();
+                injectEvent(event.status);
+                _eventTime.record((uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+            }
+        }
+    }
+
+    const Utils::LatencyHistogram& eventTime() const
+    {
+        return _eventTime;
+    }
+
+    /**
+     * @brief Print the event latency of replay() and the time the handler held m_statusMutex
+     */
+    void reportReplay(const char* name) const
+    {
+        const Utils::LatencyHistogram& hold = _plugin.m_event_lock_hold;
+        printf("[ REPLAY   ] %s: %llu events, latency us p50=%u p95=%u p99=%u max=%u, "
+               "lock hold us p50=%u p95=%u p99=%u max=%u\n",
+            name, (unsigned long long)_eventTime.count(),
+            _eventTime.percentile(50), _eventTime.percentile(95), _eventTime.percentile(99), _eventTime.max(),
+            hold.percentile(50), hold.percentile(95), hold.percentile(99), hold.max());
+    }
+
+    /**
+     * @brief Deliver a status update as the task scripts broadcast it over IARM
+     */
+    static void injectEvent(IARM_Maint_module_status_t status)
+    {
+        IARM_Bus_MaintMGR_EventData_t eventData = {};
+        eventData.data.maintenance_module_status.status = status;
+        WPEFramework::Plugin::MaintenanceManager::_MaintenanceMgrEventHandler(IARM_BUS_MAINTENANCE_MGR_NAME,
+            IARM_BUS_MAINTENANCEMGR_EVENT_UPDATE, &eventData, sizeof(eventData));
+    }
+
+private:
+    /* Status reported for each task, indexed by TaskIndices */
+    IARM_Maint_module_status_t completeEvent(int task_index) const
+    {
+        return _plugin.m_tasks[task_index].completeEvent;
+    }
+
+    IARM_Maint_module_status_t errorEvent(int task_index) const
+    {
+        return _plugin.m_tasks[task_index].errorEvent;
+    }
+
+    /* A task that cannot be started runs a script that does not exist */
+    void setCommand(int task_index)
+    {
+        _plugin.m_tasks[task_index].command = _tasks[task_index].launchFails
+            ? _dir + "/missing"
+            : _dir + "/Start_MaintenanceTasks.sh " + _plugin.m_tasks[task_index].name;
+    }
+
+    /* One script for all tasks, like Start_MaintenanceTasks.sh, taking the task name */
+    void writeTaskScript() const
+    {
+        std::string script = _dir + "/Start_MaintenanceTasks.sh";
+        FILE* fp = fopen(script.c_str(), "w");
+        if (fp == nullptr)
+        {
+            return;
+        }
+        fprintf(fp, "#!/bin/sh\ncase \"$1\" in\n");
+        for (int i = 0; i < MAX_MAINTENANCE_TASKS; i++)
+        {
+            /* the exit code is left for the simulator, which reports it as the task would over IARM */
+            fprintf(fp, "%s) sleep %u.%03u; echo %d > %s/$1.tmp; mv %s/$1.tmp %s/$1.exit; exit %d;;\n",
+                _plugin.m_tasks[i].name.c_str(), _tasks[i].durationMs / 1000, _tasks[i].durationMs % 1000, _tasks[i].exitCode,
+                _dir.c_str(), _dir.c_str(), _dir.c_str(), _tasks[i].exitCode);
+        }
+        fprintf(fp, "esac\nexit 1\n");
+        fclose(fp);
+        chmod(script.c_str(), 0755);
+    }
+
+    /* The status a task reports on exit, as the task script broadcasts it */
+    IARM_Maint_module_status_t exitEvent(int task_index, const TaskConfig& config, int exitCode) const
+    {
+        if (task_index == TASK_SWUPDATE && config.aborted)
+        {
+            return MAINT_FWDOWNLOAD_ABORTED;
+        }
+        return (exitCode == 0) ? completeEvent(task_index) : errorEvent(task_index);
+    }
+
+    /* m_spawn_stub: the task is due to exit durationMs from now, through a descriptor of an eventfd */
+    int startTask(int task_index, int& exit_fd)
+    {
+        const TaskConfig& config = _tasks[task_index];
+        if (config.launchFails)
+        {
+            return ENOENT;
+        }
+        int fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (fd < 0)
+        {
+            return errno;
+        }
+        /* the plugin closes its descriptor when it reaps the task, which may be before the exit is signalled */
+        exit_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+        if (exit_fd < 0)
+        {
+            int error = errno;
+            close(fd);
+            return error;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_pumpMutex);
+            _exits.push_back({ std::chrono::steady_clock::now() + std::chrono::milliseconds(config.durationMs),
+                task_index, exitEvent(task_index, config, config.exitCode), fd });
+        }
+        _pumpCv.notify_one();
+        return 0;
+    }
+
+    /* What the maintenance thread does before it launches the tasks, for replay() */
+    void startCycle()
+    {
+        _plugin.m_abort_flag = false;
+        _plugin.g_task_status = 0;
+        _plugin.g_maintenance_type = SOLICITED_MAINTENANCE;
+        {
+            std::lock_guard<std::mutex> lock(_plugin.m_statusMutex);
+            _plugin.onMaintenanceStatusChange(MAINTENANCE_STARTED);
+        }
+        _plugin.beginHistoryCycle();
+    }
+
+    /* Reports each task that is done, as the task script does over IARM */
+    void pumpEvents()
+    {
+        std::unique_lock<std::mutex> lock(_pumpMutex);
+        while (!_stopping)
+        {
+            if (_mode == SPAWNED_TASKS)
+            {
+                lock.unlock();
+                collectExitFiles();
+                lock.lock();
+                _pumpCv.wait_for(lock, std::chrono::milliseconds(1), [this] { return _stopping; });
+                continue;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            auto next = std::chrono::steady_clock::time_point::max();
+            std::vector<Exit> due;
+            for (auto it = _exits.begin(); it != _exits.end();)
+            {
+                if (it->due <= now)
+                {
+                    due.push_back(*it);
+                    it = _exits.erase(it);
+                    continue;
+                }
+                next = std::min(next, it->due);
+                ++it;
+            }
+            if (due.empty())
+            {
+                if (_exits.empty())
+                {
+                    _pumpCv.wait(lock);
+                }
+                else
+                {
+                    _pumpCv.wait_until(lock, next);
+                }
+                continue;
+            }
+
+            lock.unlock();
+            for (const Exit& exit : due)
+            {
+                /* the task script broadcasts its status before it exits */
+                injectEvent(exit.status);
+                uint64_t value = 1;
+                if (write(exit.fd, &value, sizeof(value)) != sizeof(value))
+                {
+                    printf("[ SIMULATE ] failed to signal the exit of task %d\n", exit.task_index);
+                }
+                close(exit.fd);
+            }
+            lock.lock();
+        }
+    }
+
+    /* Reports each task the fake script has finished */
+    void collectExitFiles()
+    {
+        for (int task_index = 0; task_index < MAX_MAINTENANCE_TASKS; task_index++)
+        {
+            std::string exitFile = _dir + "/" + _plugin.m_tasks[task_index].name + ".exit";
+            FILE* fp = fopen(exitFile.c_str(), "r");
+            if (fp == nullptr)
+            {
+                continue;
+            }
+            int exitCode = -1;
+            if (fscanf(fp, "%d", &exitCode) != 1)
+            {
+                exitCode = -1;
+            }
+            fclose(fp);
+            unlink(exitFile.c_str());
+            injectEvent(exitEvent(task_index, _tasks[task_index], exitCode));
+        }
+    }
+
+    /* Started the way startMaintenance() starts it */
+    Maint_notify_status_t runCycle()
+    {
+        _plugin.setInternetState(INTERNET_CONNECTED_STATE);
+        {
+            std::lock_guard<std::mutex> lock(_plugin.m_statusMutex);
+            _plugin.m_abort_flag = false;
+            _plugin.g_task_status = 0;
+            _plugin.g_maintenance_type = SOLICITED_MAINTENANCE;
+            if (_plugin.m_thread.joinable())
+            {
+                _plugin.m_thread.join();
+            }
+            _plugin.m_thread = std::thread(&WPEFramework::Plugin::MaintenanceManager::task_execution_thread, &_plugin);
+        }
+        /* the plugin joins the maintenance thread when it ends the cycle, before it reports the status */
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_plugin.m_statusMutex);
+                if (!_plugin.m_thread.joinable() && _plugin.m_notify_status != MAINTENANCE_STARTED)
+                {
+                    return _plugin.m_notify_status;
+                }
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    /* A task due to exit, see startTask() */
+    struct Exit
+    {
+        std::chrono::steady_clock::time_point due;
+        int task_index;
+        IARM_Maint_module_status_t status;
+        int fd;
+    };
+
+    WPEFramework::Plugin::MaintenanceManager& _plugin;
+    TaskConfig _tasks[MAX_MAINTENANCE_TASKS];
+    std::string _realCommands[MAX_MAINTENANCE_TASKS];
+    Mode _mode;
+    std::string _dir; /* of the task script, SPAWNED_TASKS only */
+    std::mutex _pumpMutex;
+    std::condition_variable _pumpCv;
+    std::vector<Exit> _exits;
+    bool _stopping;
+    std::thread _pump;
+    /* Plugin state changed for the simulation, restored on destruction */
+    bool _whoami;
+    bool _suppress;
+    bool _nwevents;
+    bool _powerSubscribed;
+    Utils::LatencyHistogram _cycleTime;
+    Utils::LatencyHistogram _eventTime;
+};
@@ -0,0 +1,126 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "UtilsAsyncLog.h"
+
+namespace {
+std::mutex g_linesMutex;
+std::vector<std::string> g_lines;
+std::thread::id g_sinkThread;
+
+void captureSink(int, const char* line)
+{
+    std::lock_guard<std::mutex> lock(g_linesMutex);
+    g_lines.push_back(line);
+    g_sinkThread = std::this_thread::get_id();
+}
+
+void clearLines()
+{
+    std::lock_guard<std::mutex> lock(g_linesMutex);
+    g_lines.clear();
+}
+}
+
+TEST(UtilsAsyncLogTest, LogsSynchronouslyUntilStarted)
+{
+    clearLines();
+    Utils::AsyncLog::instance().log(captureSink, 6, "line %d", 1);
+    ASSERT_EQ(1u, g_lines.size());
+    EXPECT_EQ("line 1", g_lines[0]);
+    EXPECT_EQ(std::this_thread::get_id(), g_sinkThread);
+}
+
+TEST(UtilsAsyncLogTest, WriterKeepsOrderAcrossThreads)
+{
+    Utils::AsyncLog& log = Utils::AsyncLog::instance();
+    clearLines();
+    log.start();
+
+    log.log(captureSink, 6, "first");
+    std::thread([&] { log.log(captureSink, 6, "second"); }).join();
+    log.log(captureSink, 6, "third");
+    log.stop();
+
+    ASSERT_EQ(3u, g_lines.size());
+    EXPECT_EQ("first", g_lines[0]);
+    EXPECT_EQ("second", g_lines[1]);
+    EXPECT_EQ("third", g_lines[2]);
+    EXPECT_NE(std::this_thread::get_id(), g_sinkThread);
+}
+
+TEST(UtilsAsyncLogTest, DropsWhenRingIsFullAndReusesRingsOfExitedThreads)
+{
+    Utils::AsyncLog& log = Utils::AsyncLog::instance();
+    clearLines();
+    log.start();
+    uint64_t dropped = log.dropped();
+
+    /* hold the writer so that the ring fills up */
+    {
+        std::lock_guard<std::mutex> lock(g_linesMutex);
+        std::thread([&] {
+            for (int i = 0; i < ASYNC_LOG_SLOTS * 4; i++) {
+                log.log(captureSink, 6, "burst %d", i);
+            }
+        }).join();
+    }
+    log.stop();
+    EXPECT_GT(log.dropped(), dropped);
+    EXPECT_EQ(ASYNC_LOG_SLOTS * 4, (int)(g_lines.size() + (log.dropped() - dropped)));
+
+    /* an error finding the ring full is written after what the ring holds */
+    clearLines();
+    log.start();
+    dropped = log.dropped();
+    {
+        std::atomic<bool> filled(false);
+        std::unique_lock<std::mutex> hold(g_linesMutex);
+        std::thread producer([&] {
+            for (int i = 0; i < ASYNC_LOG_SLOTS * 2; i++) {
+                log.log(captureSink, ASYNC_LOG_PRIORITY_INFO, "burst %d", i);
+            }
+            filled = true;
+            log.log(captureSink, ASYNC_LOG_PRIORITY_ERR, "error");
+        });
+        while (!filled) {
+            std::this_thread::yield();
+        }
+        hold.unlock();
+        producer.join();
+    }
+    ASSERT_FALSE(g_lines.empty());
+    EXPECT_EQ("error", g_lines.back());
+    EXPECT_EQ(ASYNC_LOG_SLOTS * 2 + 1, (int)(g_lines.size() + (log.dropped() - dropped)));
+    log.stop();
+
+    /* more threads than rings: exited threads hand theirs back */
+    clearLines();
+    log.start();
+    for (int i = 0; i < ASYNC_LOG_MAX_BUFFERS * 2; i++) {
+        std::thread([&] { log.log(captureSink, 6, "thread"); }).join();
+        log.flush();
+    }
+    log.stop();
+    EXPECT_EQ((size_t)ASYNC_LOG_MAX_BUFFERS * 2, g_lines.size());
+}
@@ -0,0 +1,130 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "UtilsCgroup.h"
+
+namespace {
+/* a directory laid out like a cgroup v2 group, without the kernel behind it */
+const std::string kRoot = "/tmp/UtilsCgroupTest";
+
+void touch(const std::string& path)
+{
+    std::ofstream file(path);
+}
+
+std::string readFile(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+}
+
+TEST(UtilsCgroupTest, OpenNeedsCgroupV2)
+{
+    system(("rm -rf " + kRoot).c_str());
+    Utils::Cgroup cgroup;
+    EXPECT_FALSE(cgroup.open(""));
+    EXPECT_FALSE(cgroup.open(kRoot));
+    EXPECT_FALSE(cgroup.isOpen());
+    EXPECT_EQ(-1, cgroup.openGroup("SWUPDATE", { 100, 100, 0, "" }));
+}
+
+TEST(UtilsCgroupTest, OpenGroupAppliesLimitsAndSkipsMissingControllers)
+{
+    system(("rm -rf " + kRoot).c_str());
+    mkdir(kRoot.c_str(), 0755);
+    touch(kRoot + "/cgroup.subtree_control");
+    mkdir((kRoot + "/SWUPDATE").c_str(), 0755);
+    for (const char* file : { "cpu.weight", "memory.high", "io.max" }) {
+        touch(kRoot + "/SWUPDATE/" + file);
+    }
+
+    Utils::Cgroup cgroup;
+    ASSERT_TRUE(cgroup.open(kRoot));
+    /* no io.weight: the io controller is treated as not enabled */
+    EXPECT_TRUE(cgroup.apply("SWUPDATE", { 10, 10, 64 * 1024 * 1024, "179:0 wbps=8388608" }));
+    EXPECT_EQ("10", readFile(kRoot + "/SWUPDATE/cpu.weight"));
+    EXPECT_EQ("67108864", readFile(kRoot + "/SWUPDATE/memory.high"));
+    EXPECT_EQ("179:0 wbps=8388608", readFile(kRoot + "/SWUPDATE/io.max"));
+
+    EXPECT_TRUE(cgroup.apply("SWUPDATE", { 100, 100, 0, "" }));
+    EXPECT_EQ("100", readFile(kRoot + "/SWUPDATE/cpu.weight"));
+    EXPECT_EQ("max", readFile(kRoot + "/SWUPDATE/memory.high"));
+    EXPECT_EQ("179:0 wbps=8388608", readFile(kRoot + "/SWUPDATE/io.max"));
+
+    /* a task is started inside its group, which gets its limits first */
+    int fd = cgroup.openGroup("SWUPDATE", { 20, 20, 0, "" });
+    ASSERT_GE(fd, 0);
+    struct stat st = {};
+    EXPECT_EQ(0, fstat(fd, &st));
+    EXPECT_TRUE(S_ISDIR(st.st_mode));
+    close(fd);
+    EXPECT_EQ("20", readFile(kRoot + "/SWUPDATE/cpu.weight"));
+
+    /* a group that does not exist yet is created */
+    fd = cgroup.openGroup("LOGUPLOAD", { 10, 10, 0, "" });
+    ASSERT_GE(fd, 0);
+    close(fd);
+    EXPECT_EQ(0, access((kRoot + "/LOGUPLOAD").c_str(), F_OK));
+    system(("rm -rf " + kRoot).c_str());
+}
+
+TEST(UtilsCgroupTest, UsageReadsCpuIoAndMemoryPeak)
+{
+    system(("rm -rf " + kRoot).c_str());
+    mkdir(kRoot.c_str(), 0755);
+    touch(kRoot + "/cgroup.subtree_control");
+
+    Utils::Cgroup cgroup;
+    ASSERT_TRUE(cgroup.open(kRoot));
+    Utils::CgroupUsage usage;
+    EXPECT_FALSE(cgroup.usage("RFC", usage));
+
+    mkdir((kRoot + "/RFC").c_str(), 0755);
+    std::ofstream(kRoot + "/RFC/cpu.stat") << "usage_usec 5500000\nuser_usec 4000000\nsystem_usec 1500000\n";
+    ASSERT_TRUE(cgroup.usage("RFC", usage));
+    EXPECT_EQ(4000u, usage.cpuUserMs);
+    EXPECT_EQ(1500u, usage.cpuSystemMs);
+    /* no io or memory controller */
+    EXPECT_FALSE(usage.hasIo);
+    EXPECT_EQ(0u, usage.memoryPeak);
+
+    std::ofstream(kRoot + "/RFC/io.stat") << "179:0 rbytes=4096 wbytes=8192 rios=1 wios=2 dbytes=0 dios=0\n"
+                                          << "8:0 rbytes=1024 wbytes=0 rios=1 wios=0 dbytes=0 dios=0\n";
+    std::ofstream(kRoot + "/RFC/memory.peak") << "6291456\n";
+    ASSERT_TRUE(cgroup.usage("RFC", usage));
+    EXPECT_TRUE(usage.hasIo);
+    EXPECT_EQ(5120u, usage.readBytes);
+    EXPECT_EQ(8192u, usage.writeBytes);
+    EXPECT_EQ(6291456u, usage.memoryPeak);
+
+    /* a group with files in it is not empty to rmdir(), unlike a kernel one without processes */
+    EXPECT_FALSE(cgroup.remove("RFC"));
+    system(("rm -rf " + kRoot + "/RFC/*").c_str());
+    EXPECT_TRUE(cgroup.remove("RFC"));
+    EXPECT_FALSE(cgroup.remove("RFC"));
+    system(("rm -rf " + kRoot).c_str());
+}
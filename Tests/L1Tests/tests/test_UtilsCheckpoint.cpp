@@ -0,0 +1,123 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "UtilsCheckpoint.h"
+
+namespace {
+const char* kCheckpointFile = "/tmp/UtilsCheckpointTest.bin";
+
+struct Record {
+    uint32_t value;
+    uint32_t other;
+};
+}
+
+TEST(UtilsCheckpointTest, KeepsLatestRecordAcrossInstances)
+{
+    unlink(kCheckpointFile);
+    {
+        Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+        Record record = {};
+        EXPECT_FALSE(checkpoint.load(&record));
+        for (uint32_t i = 1; i <= 3; i++) {
+            record.value = i;
+            EXPECT_TRUE(checkpoint.store(&record));
+        }
+    }
+    Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+    Record record = {};
+    EXPECT_TRUE(checkpoint.load(&record));
+    EXPECT_EQ(3u, record.value);
+
+    record.value = 4;
+    EXPECT_TRUE(checkpoint.store(&record));
+    Record reloaded = {};
+    EXPECT_TRUE(checkpoint.load(&reloaded));
+    EXPECT_EQ(4u, reloaded.value);
+    unlink(kCheckpointFile);
+}
+
+TEST(UtilsCheckpointTest, StoreWithoutLoadKeepsNewestRecord)
+{
+    unlink(kCheckpointFile);
+    {
+        Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+        Record record = {};
+        for (uint32_t i = 1; i <= 3; i++) {
+            record.value = i;
+            EXPECT_TRUE(checkpoint.store(&record));
+        }
+    }
+    {
+        /* record 3 is in slot 0, so this one goes to slot 1 with a newer sequence */
+        Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+        Record record = { 99, 0 };
+        EXPECT_TRUE(checkpoint.store(&record));
+    }
+    Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+    Record record = {};
+    EXPECT_TRUE(checkpoint.load(&record));
+    EXPECT_EQ(99u, record.value);
+    unlink(kCheckpointFile);
+}
+
+TEST(UtilsCheckpointTest, TornStoreLeavesPreviousRecord)
+{
+    unlink(kCheckpointFile);
+    {
+        Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+        Record record = { 1, 0 };
+        EXPECT_TRUE(checkpoint.store(&record)); /* slot 0 */
+        record.value = 2;
+        EXPECT_TRUE(checkpoint.store(&record)); /* slot 1 */
+    }
+    /* damage the record in the second slot, as a write cut short would */
+    int fd = open(kCheckpointFile, O_RDWR);
+    ASSERT_GE(fd, 0);
+    uint8_t garbage = 0xFF;
+    EXPECT_EQ(1, pwrite(fd, &garbage, 1, CHECKPOINT_SLOT_ALIGN + 24));
+    close(fd);
+
+    Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+    Record record = {};
+    EXPECT_TRUE(checkpoint.load(&record));
+    EXPECT_EQ(1u, record.value);
+    unlink(kCheckpointFile);
+}
+
+TEST(UtilsCheckpointTest, UnchangedRecordIsNotWrittenAgain)
+{
+    unlink(kCheckpointFile);
+    Utils::Checkpoint checkpoint(kCheckpointFile, sizeof(Record));
+    Record record = { 5, 6 };
+    EXPECT_TRUE(checkpoint.store(&record));
+    EXPECT_TRUE(checkpoint.store(&record));
+
+    /* the second slot was never written */
+    int fd = open(kCheckpointFile, O_RDONLY);
+    ASSERT_GE(fd, 0);
+    uint8_t slot[CHECKPOINT_SLOT_ALIGN];
+    EXPECT_EQ((ssize_t)sizeof(slot), pread(fd, slot, sizeof(slot), CHECKPOINT_SLOT_ALIGN));
+    close(fd);
+    uint8_t zero[CHECKPOINT_SLOT_ALIGN] = {};
+    EXPECT_EQ(0, memcmp(slot, zero, sizeof(slot)));
+    unlink(kCheckpointFile);
+}
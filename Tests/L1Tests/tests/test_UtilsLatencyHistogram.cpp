@@ -0,0 +1,56 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "UtilsLatencyHistogram.h"
+
+TEST(UtilsLatencyHistogramTest, PercentilesStayWithinBucketError)
+{
+    Utils::LatencyHistogram histogram;
+    EXPECT_EQ(0u, histogram.percentile(50));
+
+    for (uint32_t value = 1; value <= 1000; value++) {
+        histogram.record(value);
+    }
+    EXPECT_EQ(1000u, histogram.count());
+    EXPECT_EQ(1000u, histogram.max());
+
+    uint32_t p50 = histogram.percentile(50);
+    uint32_t p99 = histogram.percentile(99);
+    EXPECT_GE(p50, 500u);
+    EXPECT_LE(p50, 500u + 500u / 8);
+    EXPECT_GE(p99, 990u);
+    EXPECT_LE(p99, 1000u);
+    EXPECT_EQ(1000u, histogram.percentile(100));
+}
+
+TEST(UtilsLatencyHistogramTest, ExtremesAndReset)
+{
+    Utils::LatencyHistogram histogram;
+    histogram.record(0);
+    histogram.record(UINT32_MAX);
+    EXPECT_EQ(0u, histogram.percentile(50));
+    EXPECT_EQ(UINT32_MAX, histogram.percentile(99));
+
+    histogram.reset();
+    EXPECT_EQ(0u, histogram.count());
+    EXPECT_EQ(0u, histogram.max());
+    EXPECT_EQ(0u, histogram.percentile(99));
+}
@@ -0,0 +1,121 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <csignal>
+#include <poll.h>
+#include <sys/wait.h>
+
+#include "UtilsProcessIndex.h"
+
+namespace {
+/* unique to this test run */
+const std::string kMarker = "UtilsProcessIndexTest" + std::to_string(getpid());
+
+/* sh keeps the marker in its command line and forks sleep, in a group of their own */
+pid_t startMarkedProcess()
+{
+    std::string command = "sleep 30; : " + kMarker;
+    pid_t pid = fork();
+    if (pid == 0) {
+        setpgid(0, 0);
+        execl("/bin/sh", "sh", "-c", command.c_str(), (char*)NULL);
+        _exit(EXIT_FAILURE);
+    }
+    setpgid(pid, pid);
+    return pid;
+}
+
+void stopProcess(pid_t pid)
+{
+    killpg(pid, SIGKILL);
+    int status;
+    waitpid(pid, &status, 0);
+}
+
+/* Dispatches events until done() or two seconds passed */
+template <typename DONE>
+bool dispatchUntil(Utils::ProcessIndex& index, int fd, DONE done)
+{
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        poll(&pfd, 1, 100);
+        index.dispatch();
+    }
+    return true;
+}
+}
+
+TEST(UtilsProcessIndexTest, FindsProcessesWithoutConnector)
+{
+    Utils::ProcessIndex index({ kMarker });
+    pid_t pid = startMarkedProcess();
+    ASSERT_GT(pid, 0);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (index.find(kMarker) != pid && std::chrono::steady_clock::now() < deadline) {
+        usleep(10000);
+    }
+    EXPECT_EQ(pid, index.find(kMarker));
+    EXPECT_TRUE(index.descendants(kMarker).empty());
+    EXPECT_EQ((pid_t)-1, index.find("UtilsProcessIndexTestNoSuchProcess"));
+    stopProcess(pid);
+}
+
+TEST(UtilsProcessIndexTest, SetNamesChangesIndexedNames)
+{
+    Utils::ProcessIndex index({ "UtilsProcessIndexTestNoSuchProcess" });
+    int fd = index.open();
+    if (fd < 0) {
+        GTEST_SKIP() << "process connector unavailable (needs CAP_NET_ADMIN)";
+    }
+    pid_t pid = startMarkedProcess();
+    ASSERT_GT(pid, 0);
+
+    index.setNames({ kMarker });
+    /* seeded by the scan, or by the exec event if sh had not exec'd yet */
+    EXPECT_TRUE(dispatchUntil(index, fd, [&] { return index.find(kMarker) == pid; }));
+    stopProcess(pid);
+}
+
+TEST(UtilsProcessIndexTest, FollowsForkExecAndExitEvents)
+{
+    Utils::ProcessIndex index({ kMarker });
+    int fd = index.open();
+    if (fd < 0) {
+        GTEST_SKIP() << "process connector unavailable (needs CAP_NET_ADMIN)";
+    }
+    EXPECT_EQ((pid_t)-1, index.find(kMarker));
+
+    pid_t pid = startMarkedProcess();
+    ASSERT_GT(pid, 0);
+    EXPECT_TRUE(dispatchUntil(index, fd, [&] { return index.find(kMarker) == pid; }));
+    /* the sleep forked by sh */
+    EXPECT_TRUE(dispatchUntil(index, fd, [&] { return index.descendants(kMarker).size() == 1; }));
+
+    stopProcess(pid);
+    EXPECT_TRUE(dispatchUntil(index, fd, [&] { return index.find(kMarker) == (pid_t)-1; }));
+    index.close();
+}
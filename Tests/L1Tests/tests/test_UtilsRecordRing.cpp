@@ -0,0 +1,69 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "UtilsRecordRing.h"
+
+namespace {
+const char* kRingFile = "/tmp/UtilsRecordRingTest.bin";
+}
+
+TEST(UtilsRecordRingTest, OverwritesOldestAndReadsNewestFirst)
+{
+    unlink(kRingFile);
+    Utils::RecordRing ring(kRingFile, sizeof(uint32_t), 4);
+    EXPECT_EQ(0u, ring.count());
+
+    for (uint32_t i = 0; i < 6; i++) {
+        EXPECT_TRUE(ring.append(&i));
+    }
+    EXPECT_EQ(4u, ring.count());
+
+    uint32_t value = 0;
+    uint64_t sequence = 0;
+    EXPECT_TRUE(ring.read(0, &value, &sequence));
+    EXPECT_EQ(5u, value);
+    EXPECT_EQ(5u, sequence);
+    EXPECT_TRUE(ring.read(3, &value));
+    EXPECT_EQ(2u, value);
+    EXPECT_FALSE(ring.read(4, &value));
+}
+
+TEST(UtilsRecordRingTest, KeepsRecordsAcrossInstancesAndResetsOnLayoutChange)
+{
+    unlink(kRingFile);
+    {
+        Utils::RecordRing ring(kRingFile, sizeof(uint32_t), 4);
+        uint32_t value = 7;
+        EXPECT_TRUE(ring.append(&value));
+    }
+    {
+        Utils::RecordRing ring(kRingFile, sizeof(uint32_t), 4);
+        uint32_t value = 0;
+        EXPECT_EQ(1u, ring.count());
+        EXPECT_TRUE(ring.read(0, &value));
+        EXPECT_EQ(7u, value);
+    }
+    {
+        Utils::RecordRing ring(kRingFile, sizeof(uint64_t), 4);
+        EXPECT_EQ(0u, ring.count());
+    }
+    unlink(kRingFile);
+}
@@ -0,0 +1,154 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+
+#include "UtilsSpawn.h"
+
+TEST(UtilsSpawnTest, spawnProcess_runsInOwnProcessGroup)
+{
+    pid_t pid = -1;
+    ASSERT_EQ(0, Utils::spawnProcess("/bin/sleep 100", pid));
+    ASSERT_GT(pid, 0);
+    EXPECT_EQ(pid, getpgid(pid));
+
+    int pidfd = Utils::pidfdOpen(pid);
+    if (pidfd < 0)
+    {
+        EXPECT_EQ(ENOSYS, errno);
+    }
+    else
+    {
+        close(pidfd);
+    }
+
+    EXPECT_EQ(0, killpg(pid, SIGTERM));
+    int status = 0;
+    EXPECT_EQ(pid, waitpid(pid, &status, 0));
+    EXPECT_TRUE(WIFSIGNALED(status));
+    EXPECT_EQ(SIGTERM, WTERMSIG(status));
+}
+
+TEST(UtilsSpawnTest, spawnProcess_reportsMissingProgram)
+{
+    pid_t pid = -1;
+    EXPECT_EQ(ENOENT, Utils::spawnProcess("/bin/non_existent_task arg", pid));
+    EXPECT_EQ(EINVAL, Utils::spawnProcess("   ", pid));
+}
+
+TEST(UtilsSpawnTest, waitProcess_collectsUsageOfChildren)
+{
+    const char* script = "/tmp/UtilsSpawnTest.sh";
+    FILE* fp = fopen(script, "w");
+    ASSERT_NE(nullptr, fp);
+    /* the shell waits for dd, so the usage of dd is included */
+    fputs("dd if=/dev/zero of=/dev/null bs=64k count=256 2>/dev/null\n", fp);
+    fclose(fp);
+
+    pid_t pid = -1;
+    ASSERT_EQ(0, Utils::spawnProcess(std::string("/bin/sh ") + script, pid));
+    ASSERT_GT(pid, 0);
+
+    int status = -1;
+    Utils::ProcessUsage usage = {};
+    EXPECT_EQ(pid, Utils::waitProcess(pid, status, 0, usage));
+    EXPECT_TRUE(WIFEXITED(status));
+    EXPECT_GT(usage.maxRssKb, 0u);
+    if (access("/proc/self/io", R_OK) == 0)
+    {
+        EXPECT_GE(usage.readBytes, 256u * 64 * 1024);
+        EXPECT_GE(usage.writeBytes, 256u * 64 * 1024);
+    }
+
+    EXPECT_EQ(-1, Utils::waitProcess(pid, status, 0, usage));
+    EXPECT_EQ(ECHILD, errno);
+    unlink(script);
+}
+
+TEST(UtilsSpawnTest, waitProcess_leavesRunningChild)
+{
+    pid_t pid = -1;
+    ASSERT_EQ(0, Utils::spawnProcess("/bin/sleep 100", pid));
+
+    int status = -1;
+    Utils::ProcessUsage usage = {};
+    EXPECT_EQ(0, Utils::waitProcess(pid, status, WNOHANG, usage));
+
+    EXPECT_EQ(0, killpg(pid, SIGKILL));
+    EXPECT_EQ(pid, Utils::waitProcess(pid, status, 0, usage));
+    EXPECT_TRUE(WIFSIGNALED(status));
+}
+
+TEST(UtilsSpawnTest, spawnProcess_startsInCgroup)
+{
+    /* needs a writable cgroup v2 hierarchy, as the plugin does */
+    std::string group;
+    for (const char* mount : { "/sys/fs/cgroup", "/sys/fs/cgroup/unified" })
+    {
+        if (access((std::string(mount) + "/cgroup.procs").c_str(), W_OK) == 0
+            && access((std::string(mount) + "/cgroup.subtree_control").c_str(), F_OK) == 0)
+        {
+            group = std::string(mount) + "/UtilsSpawnTest";
+            break;
+        }
+    }
+    if (group.empty() || (mkdir(group.c_str(), 0755) != 0 && errno != EEXIST))
+    {
+        GTEST_SKIP() << "no writable cgroup v2 hierarchy";
+    }
+    int cgroupFd = open(group.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    ASSERT_GE(cgroupFd, 0);
+
+    const char* script = "/tmp/UtilsSpawnTest.sh";
+    const char* output = "/tmp/UtilsSpawnTest.cgroup";
+    FILE* fp = fopen(script, "w");
+    ASSERT_NE(nullptr, fp);
+    /* cat is started by the script, so it shows where the children run */
+    fprintf(fp, "cat /proc/self/cgroup > %s\n", output);
+    fclose(fp);
+
+    pid_t pid = -1;
+    ASSERT_EQ(0, Utils::spawnProcess(std::string("/bin/sh ") + script, pid, cgroupFd));
+    EXPECT_EQ(pid, getpgid(pid));
+    int status = -1;
+    EXPECT_EQ(pid, waitpid(pid, &status, 0));
+    EXPECT_TRUE(WIFEXITED(status));
+
+    char line[256] = {};
+    fp = fopen(output, "r");
+    ASSERT_NE(nullptr, fp);
+    std::string v2;
+    while (fgets(line, sizeof(line), fp) != nullptr)
+    {
+        if (strncmp(line, "0::", 3) == 0)
+        {
+            v2 = line;
+        }
+    }
+    fclose(fp);
+    EXPECT_EQ("/UtilsSpawnTest\n", v2.substr(v2.rfind('/')));
+
+    EXPECT_EQ(ENOENT, Utils::spawnProcess("/bin/non_existent_task", pid, cgroupFd));
+    close(cgroupFd);
+    unlink(script);
+    unlink(output);
+    rmdir(group.c_str());
+}
@@ -0,0 +1,103 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "UtilsTelemetry.h"
+#include "UtilsTelemetryBatcher.h"
+
+namespace {
+struct Sent {
+    std::vector<std::pair<std::string, int>> counters;
+    std::vector<std::pair<std::string, std::string>> messages;
+};
+}
+
+TEST(UtilsTelemetryBatcherTest, AggregatesCountersPerMarker)
+{
+    Sent sent;
+    Utils::TelemetryBatcher batcher(
+        [&](const char* marker, int value) { sent.counters.emplace_back(marker, value); },
+        [&](const char* marker, const char* value) { sent.messages.emplace_back(marker, value); });
+
+    EXPECT_TRUE(batcher.count("SYST_ERR_RFC"));
+    EXPECT_TRUE(batcher.count("SYST_INFO_SOMT"));
+    EXPECT_TRUE(batcher.count("SYST_ERR_RFC", 2));
+    EXPECT_TRUE(batcher.message("THUNDER_ERROR", "failed"));
+    EXPECT_TRUE(sent.counters.empty());
+
+    batcher.flush();
+    ASSERT_EQ(2u, sent.counters.size());
+    EXPECT_EQ(std::make_pair(std::string("SYST_ERR_RFC"), 3), sent.counters[0]);
+    EXPECT_EQ(std::make_pair(std::string("SYST_INFO_SOMT"), 1), sent.counters[1]);
+    ASSERT_EQ(1u, sent.messages.size());
+    EXPECT_EQ("failed", sent.messages[0].second);
+    EXPECT_EQ(4u, batcher.delivered());
+}
+
+TEST(UtilsTelemetryBatcherTest, CountsDroppedEventsWhenFull)
+{
+    int total = 0;
+    Utils::TelemetryBatcher batcher([&](const char*, int value) { total += value; }, nullptr);
+
+    for (int i = 0; i < TELEMETRY_QUEUE_SIZE + 5; i++) {
+        batcher.count("MARKER");
+    }
+    EXPECT_EQ(5u, batcher.dropped());
+
+    batcher.flush();
+    EXPECT_EQ(TELEMETRY_QUEUE_SIZE, total);
+    EXPECT_TRUE(batcher.count("MARKER"));
+}
+
+TEST(UtilsTelemetryBatcherTest, BackgroundThreadFlushesAndStopDrains)
+{
+    std::atomic<int> total(0);
+    Utils::TelemetryBatcher batcher([&](const char*, int value) { total += value; }, nullptr, 10);
+    batcher.start();
+
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; t++) {
+        producers.emplace_back([&] {
+            for (int i = 0; i < 1000; i++) {
+                while (!batcher.count("MARKER")) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    batcher.stop();
+    EXPECT_EQ(4000, total.load());
+}
+
+TEST(UtilsTelemetryBatcherTest, SharedBatcherIsOneRunningInstance)
+{
+    Utils::TelemetryBatcher& shared = Utils::Telemetry::batcher();
+    EXPECT_EQ(&shared, &Utils::Telemetry::batcher());
+
+    const size_t delivered = shared.delivered();
+    EXPECT_TRUE(shared.message("THUNDER_ERROR", "failed"));
+    shared.flush();
+    EXPECT_EQ(delivered + 1, shared.delivered());
+}
@@ -0,0 +1,129 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+
+#include "UtilsTimeZone.h"
+
+TEST(UtilsTimeZoneTest, emptyAndUnknownZonesAreUTC)
+{
+    auto utc = Utils::TimeZone::Get("");
+    EXPECT_EQ(0, utc->offsetAt(1773896400));
+    EXPECT_EQ(1773910200, utc->toUtc(2026, 3, 19, 8, 50, 0));
+
+    auto unknown = Utils::TimeZone::Get("Nowhere/Atlantis");
+    EXPECT_FALSE(unknown->isValid());
+    EXPECT_EQ(0, unknown->offsetAt(1773896400));
+}
+
+TEST(UtilsTimeZoneTest, posixRule_dstEdges)
+{
+    auto zone = Utils::TimeZone::Get("EST5EDT,M3.2.0,M11.1.0");
+    ASSERT_TRUE(zone->isValid());
+
+    bool isdst = true;
+    EXPECT_EQ(-5 * 3600, zone->offsetAt(1805007599, &isdst)); /* 2027-03-14 01:59:59 EST */
+    EXPECT_FALSE(isdst);
+    EXPECT_EQ(-4 * 3600, zone->offsetAt(1805007600, &isdst)); /* 2027-03-14 03:00:00 EDT */
+    EXPECT_TRUE(isdst);
+
+    /* skipped hour moves forward, repeated hour resolves to its first occurrence */
+    EXPECT_EQ(1805008860, zone->toUtc(2027, 3, 14, 2, 21, 0));
+    EXPECT_EQ(1825565400, zone->toUtc(2027, 11, 7, 1, 30, 0));
+    /* day overflow is normalised */
+    EXPECT_EQ(zone->toUtc(2027, 4, 1, 4, 50, 0), zone->toUtc(2027, 3, 32, 4, 50, 0));
+
+    struct tm local;
+    zone->localTime(1825565400, local);
+    EXPECT_EQ(127, local.tm_year);
+    EXPECT_EQ(10, local.tm_mon);
+    EXPECT_EQ(7, local.tm_mday);
+    EXPECT_EQ(1, local.tm_hour);
+    EXPECT_EQ(30, local.tm_min);
+    EXPECT_EQ(1, local.tm_isdst);
+}
+
+TEST(UtilsTimeZoneTest, posixRule_southernHemisphereAndQuotedNames)
+{
+    auto sydney = Utils::TimeZone::Get("AEST-10AEDT,M10.1.0,M4.1.0/3");
+    EXPECT_EQ(11 * 3600, sydney->offsetAt(1767225600)); /* 2026-01-01 UTC, summer */
+    EXPECT_EQ(10 * 3600, sydney->offsetAt(1782864000)); /* 2026-07-01 UTC, winter */
+
+    auto india = Utils::TimeZone::Get("<+0530>-5:30");
+    EXPECT_EQ(5 * 3600 + 30 * 60, india->offsetAt(1782864000));
+}
+
+/* Compare against glibc for the zoneinfo files installed on the build host */
+TEST(UtilsTimeZoneTest, zoneinfo_matchesLibc)
+{
+    const char* zones[] = { "America/New_York", "Europe/London", "Australia/Sydney", "Asia/Kolkata", "America/Sao_Paulo", "Pacific/Chatham" };
+    const char* savedTz = getenv("TZ");
+    std::string saved = savedTz ? savedTz : "";
+
+    for (const char* name : zones)
+    {
+        auto zone = Utils::TimeZone::Get(name);
+        if (!zone->isValid())
+        {
+            continue;
+        }
+        setenv("TZ", name, 1);
+        tzset();
+        for (int64_t t = 0; t < 4102444800LL; t += 86400 * 3 + 3571)
+        {
+            time_t tt = (time_t)t;
+            struct tm expected, actual;
+            localtime_r(&tt, &expected);
+            zone->localTime(t, actual);
+            ASSERT_EQ(expected.tm_year, actual.tm_year) << name << " " << t;
+            ASSERT_EQ(expected.tm_yday, actual.tm_yday) << name << " " << t;
+            ASSERT_EQ(expected.tm_hour, actual.tm_hour) << name << " " << t;
+            ASSERT_EQ(expected.tm_min, actual.tm_min) << name << " " << t;
+            ASSERT_EQ(expected.tm_isdst, actual.tm_isdst) << name << " " << t;
+        }
+    }
+
+    if (savedTz)
+    {
+        setenv("TZ", saved.c_str(), 1);
+    }
+    else
+    {
+        unsetenv("TZ");
+    }
+    tzset();
+}
+
+TEST(UtilsTimeZoneTest, toUtc_benchmark)
+{
+    const int iterations = 100000;
+    volatile int64_t sink = 0;
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++)
+    {
+        sink = sink + Utils::TimeZone::Get("America/New_York")->toUtc(2026, 1, 1 + i % 730, 4, 50, 0);
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    std::cout << "TimeZone::Get + toUtc: " << (elapsed / iterations) << " ns per call" << std::endl;
+    EXPECT_LT(elapsed / iterations, 100000);
+}
@@ -0,0 +1,338 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <syscall.h>
+#include <unistd.h>
+
+#define ASYNC_LOG_LINE_SIZE     512 /* longer lines are truncated */
+#define ASYNC_LOG_SLOTS         32  /* lines buffered per thread, must be a power of two */
+#define ASYNC_LOG_MAX_BUFFERS   16  /* threads with a buffer; others log synchronously */
+
+/* syslog priorities, as expected by the journal */
+#define ASYNC_LOG_PRIORITY_ERR      3
+#define ASYNC_LOG_PRIORITY_WARNING  4
+#define ASYNC_LOG_PRIORITY_INFO     6
+
+namespace Utils
+{
+/**
+* @brief Logging backend that moves formatting output off the caller's thread.
+*
+* Each logging thread gets its own single-producer ring of ASYNC_LOG_SLOTS
+* lines and formats straight into it; a background writer merges the rings
+* in the order the lines were logged and hands them to their sink, flushing
+* stderr once per batch. Memory is bounded by ASYNC_LOG_MAX_BUFFERS rings;
+* a thread that finds its ring full drops an info line and counts it in
+* dropped(), but writes the ring and then an error or warning itself. A
+* thread that gets no ring, or any thread while the writer is not started,
+* logs synchronously as before. Rings of exited threads are reused.
+*/
+class AsyncLog
+{
+public:
+    typedef void (*Sink)(int priority, const char* line);
+
+    static AsyncLog& instance()
+    {
+        static AsyncLog log;
+        return log;
+    }
+
+    static void stderrSink(int, const char* line)
+    {
+        fputs(line, stderr);
+        fputc('\n', stderr);
+    }
+
+    static int threadId()
+    {
+        static thread_local int tid = (int)syscall(SYS_gettid);
+        return tid;
+    }
+
+    ~AsyncLog()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_threadMutex);
+            _users = 1;
+        }
+        stop();
+    }
+
+    AsyncLog(const AsyncLog&) = delete;
+    AsyncLog& operator=(const AsyncLog&) = delete;
+
+    /**
+    * @brief Start the writer; calls are counted so that every user can start and stop it
+    */
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(_threadMutex);
+        if (_users++ == 0)
+        {
+            _running.store(true, std::memory_order_release);
+            _writer = std::thread(&AsyncLog::run, this);
+        }
+    }
+
+    /**
+    * @brief Stop the writer once the last user stops it, writing what is still buffered
+    */
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_threadMutex);
+            if ((_users == 0) || (--_users > 0))
+            {
+                return;
+            }
+            _running.store(false, std::memory_order_release);
+        }
+        _wakeup.notify_all();
+        if (_writer.joinable())
+        {
+            _writer.join();
+        }
+        flush();
+    }
+
+    /**
+    * @brief Format a line and queue it for sink
+    * @param[in] sink - Writes the line, called on the writer thread
+    * @param[in] priority - Syslog priority passed to sink
+    */
+    void log(Sink sink, int priority, const char* format, ...) __attribute__((format(printf, 4, 5)))
+    {
+        va_list arguments;
+        va_start(arguments, format);
+        Buffer* buffer = _running.load(std::memory_order_acquire) ? threadBuffer() : nullptr;
+        if (buffer == nullptr)
+        {
+            char line[ASYNC_LOG_LINE_SIZE];
+            vsnprintf(line, sizeof(line), format, arguments);
+            va_end(arguments);
+            sink(priority, line);
+            fflush(stderr);
+            return;
+        }
+
+        uint32_t head = buffer->head.load(std::memory_order_relaxed);
+        if ((head - buffer->tail.load(std::memory_order_acquire)) >= ASYNC_LOG_SLOTS)
+        {
+            if (priority > ASYNC_LOG_PRIORITY_WARNING)
+            {
+                va_end(arguments);
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            /* errors and warnings are not lost: the lines before them go first */
+            flush();
+            char line[ASYNC_LOG_LINE_SIZE];
+            vsnprintf(line, sizeof(line), format, arguments);
+            va_end(arguments);
+            std::lock_guard<std::mutex> drainLock(_drainMutex);
+            sink(priority, line);
+            fflush(stderr);
+            return;
+        }
+        Slot& slot = buffer->slots[head & (ASYNC_LOG_SLOTS - 1)];
+        vsnprintf(slot.line, sizeof(slot.line), format, arguments);
+        va_end(arguments);
+        slot.sink = sink;
+        slot.priority = priority;
+        slot.sequence = _sequence.fetch_add(1, std::memory_order_relaxed);
+        buffer->head.store(head + 1, std::memory_order_release);
+
+        if (!_signalled.load(std::memory_order_relaxed) && !_signalled.exchange(true, std::memory_order_acq_rel))
+        {
+            _wakeup.notify_one();
+        }
+    }
+
+    /**
+    * @brief Write every buffered line now
+    */
+    void flush()
+    {
+        std::lock_guard<std::mutex> drainLock(_drainMutex);
+        std::lock_guard<std::mutex> lock(_buffersMutex);
+        std::vector<Slot*> lines;
+        std::vector<uint32_t> heads(_buffers.size());
+        std::vector<bool> released(_buffers.size());
+
+        for (size_t i = 0; i < _buffers.size(); i++)
+        {
+            Buffer& buffer = *_buffers[i];
+            /* read before head: once released is seen, head is final */
+            released[i] = buffer.released.load(std::memory_order_acquire);
+            heads[i] = buffer.head.load(std::memory_order_acquire);
+            for (uint32_t index = buffer.tail.load(std::memory_order_relaxed); index != heads[i]; index++)
+            {
+                lines.push_back(&buffer.slots[index & (ASYNC_LOG_SLOTS - 1)]);
+            }
+        }
+
+        std::sort(lines.begin(), lines.end(), [](const Slot* a, const Slot* b) { return a->sequence < b->sequence; });
+        for (const Slot* slot : lines)
+        {
+            slot->sink(slot->priority, slot->line);
+        }
+        if (!lines.empty())
+        {
+            fflush(stderr);
+        }
+
+        for (size_t i = 0; i < _buffers.size(); i++)
+        {
+            Buffer& buffer = *_buffers[i];
+            buffer.tail.store(heads[i], std::memory_order_release);
+            if (released[i])
+            {
+                buffer.head.store(0, std::memory_order_relaxed);
+                buffer.tail.store(0, std::memory_order_relaxed);
+                buffer.released.store(false, std::memory_order_relaxed);
+                buffer.inUse = false;
+            }
+        }
+    }
+
+    /**
+    * @return The number of lines dropped because a thread's ring was full
+    */
+    uint64_t dropped() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        uint64_t sequence;
+        Sink sink;
+        int priority;
+        char line[ASYNC_LOG_LINE_SIZE];
+    };
+
+    struct Buffer
+    {
+        Buffer()
+            : head(0)
+            , tail(0)
+            , released(false)
+            , inUse(true)
+        {
+        }
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+        std::atomic<bool> released; /* set when the owning thread exits */
+        bool inUse;                 /* guarded by _buffersMutex */
+        Slot slots[ASYNC_LOG_SLOTS];
+    };
+
+    /* Hands the ring back when the thread exits */
+    struct Owner
+    {
+        Buffer* buffer = nullptr;
+        bool denied = false;
+        ~Owner()
+        {
+            if (buffer != nullptr)
+            {
+                buffer->released.store(true, std::memory_order_release);
+            }
+        }
+    };
+
+    AsyncLog()
+        : _users(0)
+        , _running(false)
+        , _signalled(false)
+        , _sequence(0)
+        , _dropped(0)
+    {
+    }
+
+    Buffer* threadBuffer()
+    {
+        static thread_local Owner owner;
+        if ((owner.buffer == nullptr) && !owner.denied)
+        {
+            std::lock_guard<std::mutex> lock(_buffersMutex);
+            for (auto& buffer : _buffers)
+            {
+                if (!buffer->inUse)
+                {
+                    buffer->inUse = true;
+                    owner.buffer = buffer.get();
+                    break;
+                }
+            }
+            if ((owner.buffer == nullptr) && (_buffers.size() < ASYNC_LOG_MAX_BUFFERS))
+            {
+                _buffers.emplace_back(new Buffer());
+                owner.buffer = _buffers.back().get();
+            }
+            owner.denied = (owner.buffer == nullptr);
+        }
+        return owner.buffer;
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_threadMutex);
+        while (_running.load(std::memory_order_acquire))
+        {
+            /* the timeout covers a notification sent just before waiting */
+            _wakeup.wait_for(lock, std::chrono::seconds(1), [this] {
+                return !_running.load(std::memory_order_acquire) || _signalled.load(std::memory_order_acquire);
+            });
+            _signalled.store(false, std::memory_order_release);
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
+
+    std::mutex _threadMutex;
+    std::condition_variable _wakeup;
+    std::thread _writer;
+    uint32_t _users;
+    std::atomic<bool> _running;
+    std::atomic<bool> _signalled;
+
+    std::mutex _drainMutex;
+    std::mutex _buffersMutex;
+    std::vector<std::unique_ptr<Buffer>> _buffers;
+    std::atomic<uint64_t> _sequence;
+    std::atomic<uint64_t> _dropped;
+};
+} // namespace Utils
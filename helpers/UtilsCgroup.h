@@ -0,0 +1,238 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace Utils
+{
+/**
+* @brief Resource limits of a cgroup v2 group
+*/
+struct CgroupLimits
+{
+    uint32_t cpuWeight;  /* cpu.weight, 1 to 10000, 100 is the kernel default */
+    uint32_t ioWeight;   /* io.weight, 1 to 10000, 100 is the kernel default */
+    uint64_t memoryHigh; /* memory.high in bytes, 0 for no limit */
+    std::string ioMax;   /* io.max line, e.g. "179:0 wbps=8388608"; empty to leave io.max alone */
+};
+
+/**
+* @brief Resources used by the processes of a cgroup v2 group since it was created
+*/
+struct CgroupUsage
+{
+    uint64_t cpuUserMs;   /* cpu.stat user_usec */
+    uint64_t cpuSystemMs; /* cpu.stat system_usec */
+    bool hasIo;           /* io.stat is there, i.e. the io controller is enabled */
+    uint64_t readBytes;   /* io.stat rbytes of every device */
+    uint64_t writeBytes;  /* io.stat wbytes of every device */
+    uint64_t memoryPeak;  /* memory.peak in bytes, 0 before Linux 5.19 or without the memory controller */
+};
+
+/**
+* @brief Child groups of one cgroup v2 directory, one per contained job.
+*
+* open() creates the directory and enables the cpu, io and memory controllers
+* for its children; a controller the kernel or the parent does not provide is
+* skipped, and so are its limits. openGroup() creates a named child, or reuses
+* it, and opens it for a process to be started in; the processes it starts stay
+* there too. remove() deletes a child once its processes have exited, so that
+* the next one starts with fresh counters.
+*/
+class Cgroup
+{
+public:
+    Cgroup()
+    {
+    }
+
+    Cgroup(const Cgroup&) = delete;
+    Cgroup& operator=(const Cgroup&) = delete;
+
+    /**
+    * @param[in] root - Directory under a cgroup v2 mount, e.g. /sys/fs/cgroup/maintenance
+    * @return true if processes can be attached to children of root
+    */
+    bool open(const std::string& root)
+    {
+        _root.clear();
+        if (root.empty() || (mkdir(root.c_str(), 0755) != 0 && errno != EEXIST))
+        {
+            return false;
+        }
+        /* cgroup v1 has no cgroup.subtree_control */
+        if (access((root + "/cgroup.subtree_control").c_str(), W_OK) != 0)
+        {
+            return false;
+        }
+        for (const char* controller : { "+cpu", "+io", "+memory" })
+        {
+            writeFile(root + "/cgroup.subtree_control", controller);
+        }
+        _root = root;
+        return true;
+    }
+
+    bool isOpen() const
+    {
+        return !_root.empty();
+    }
+
+    /**
+    * @brief Apply limits to a child and open it, to start a process in it with spawnProcess()
+    * @param[in] name - The child group
+    * @param[in] limits - The limits of the child
+    * @return A descriptor of the child's directory for the caller to close, or -1 with errno set
+    */
+    int openGroup(const std::string& name, const CgroupLimits& limits)
+    {
+        if (!isOpen())
+        {
+            errno = ENOENT;
+            return -1;
+        }
+        std::string path = _root + "/" + name;
+        if (mkdir(path.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            return -1;
+        }
+        apply(name, limits);
+        return ::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    }
+
+    /**
+    * @brief Change the limits of a child and of the processes in it
+    * @return true if every limit the kernel supports was written
+    */
+    bool apply(const std::string& name, const CgroupLimits& limits)
+    {
+        if (!isOpen())
+        {
+            return false;
+        }
+        std::string path = _root + "/" + name;
+        bool success = true;
+        success &= writeOptional(path + "/cpu.weight", std::to_string(limits.cpuWeight));
+        success &= writeOptional(path + "/io.weight", "default " + std::to_string(limits.ioWeight));
+        success &= writeOptional(path + "/memory.high", (limits.memoryHigh == 0) ? std::string("max") : std::to_string(limits.memoryHigh));
+        if (!limits.ioMax.empty())
+        {
+            success &= writeOptional(path + "/io.max", limits.ioMax);
+        }
+        return success;
+    }
+
+    /**
+    * @brief Read what the processes of a child have used
+    * @return false if the child has no cpu.stat, e.g. it does not exist
+    */
+    bool usage(const std::string& name, CgroupUsage& usage) const
+    {
+        memset(&usage, 0, sizeof(usage));
+        if (!isOpen())
+        {
+            return false;
+        }
+        std::string path = _root + "/" + name;
+        FILE* fp = fopen((path + "/cpu.stat").c_str(), "re");
+        if (fp == nullptr)
+        {
+            return false;
+        }
+        char key[64];
+        uint64_t value;
+        while (fscanf(fp, "%63s %" SCNu64, key, &value) == 2)
+        {
+            if (strcmp(key, "user_usec") == 0)
+                usage.cpuUserMs = value / 1000;
+            else if (strcmp(key, "system_usec") == 0)
+                usage.cpuSystemMs = value / 1000;
+        }
+        fclose(fp);
+
+        /* one line per device: "<major>:<minor> rbytes=<n> wbytes=<n> rios=<n> ..." */
+        fp = fopen((path + "/io.stat").c_str(), "re");
+        if (fp != nullptr)
+        {
+            usage.hasIo = true;
+            char field[64];
+            while (fscanf(fp, "%63s", field) == 1)
+            {
+                if (sscanf(field, "rbytes=%" SCNu64, &value) == 1)
+                    usage.readBytes += value;
+                else if (sscanf(field, "wbytes=%" SCNu64, &value) == 1)
+                    usage.writeBytes += value;
+            }
+            fclose(fp);
+        }
+
+        fp = fopen((path + "/memory.peak").c_str(), "re");
+        if (fp != nullptr)
+        {
+            if (fscanf(fp, "%" SCNu64, &value) == 1)
+            {
+                usage.memoryPeak = value;
+            }
+            fclose(fp);
+        }
+        return true;
+    }
+
+    /**
+    * @brief Remove a child, so that the next process starts with fresh counters
+    * @return false if it still holds processes or does not exist
+    */
+    bool remove(const std::string& name)
+    {
+        return isOpen() && rmdir((_root + "/" + name).c_str()) == 0;
+    }
+
+private:
+    static bool writeFile(const std::string& path, const std::string& value)
+    {
+        int fd = ::open(path.c_str(), O_WRONLY | O_TRUNC | O_CLOEXEC);
+        if (fd < 0)
+        {
+            return false;
+        }
+        bool written = (write(fd, value.c_str(), value.size()) == (ssize_t)value.size());
+        close(fd);
+        return written;
+    }
+
+    /* A missing file means the controller is not enabled, which is not an error */
+    static bool writeOptional(const std::string& path, const std::string& value)
+    {
+        return writeFile(path, value) || (errno == ENOENT);
+    }
+
+    std::string _root;
+};
+} // namespace Utils
@@ -0,0 +1,231 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CHECKPOINT_MAGIC 0x434B5054 /* "CKPT" */
+#define CHECKPOINT_SLOT_ALIGN 512   /* A torn write of one slot never reaches the other */
+
+namespace Utils
+{
+/**
+* @brief One small fixed-size record kept durably in a file.
+*
+* The file holds two slots; store() writes the slot not holding the latest
+* record and calls fdatasync(), so a store cut short by power loss leaves the
+* previous record readable. Each slot carries a sequence number and a
+* checksum, and load() returns the newest valid one; the file is scanned for
+* it on open as well, so a store() without a load() never overwrites it. The
+* file keeps its size once created, so a store flushes one slot and no
+* metadata, and storing the record already in place writes nothing.
+*/
+class Checkpoint
+{
+public:
+    /**
+    * @param[in] path - The file holding the record, created on first store
+    * @param[in] recordSize - The size of the record in bytes
+    */
+    Checkpoint(const std::string& path, uint32_t recordSize)
+        : _path(path)
+        , _recordSize(recordSize)
+        , _slotSize(((sizeof(SlotHeader) + recordSize + CHECKPOINT_SLOT_ALIGN - 1) / CHECKPOINT_SLOT_ALIGN) * CHECKPOINT_SLOT_ALIGN)
+        , _fd(-1)
+        , _sequence(0)
+        , _slot(-1)
+    {
+    }
+
+    ~Checkpoint()
+    {
+        if (_fd >= 0)
+        {
+            close(_fd);
+        }
+    }
+
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+
+    /**
+    * @brief Read the latest record
+    * @param[out] record - recordSize bytes
+    * @return false if the file holds no valid record
+    */
+    bool load(void* record)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!openFile(false))
+        {
+            return false;
+        }
+        scanSlots();
+        if (_slot < 0)
+        {
+            return false;
+        }
+        memcpy(record, _last.data(), _recordSize);
+        return true;
+    }
+
+    /**
+    * @brief Replace the record and wait until it is on storage
+    * @param[in] record - recordSize bytes
+    * @return true if the record is stored
+    */
+    bool store(const void* record)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!openFile(true))
+        {
+            return false;
+        }
+        if (_slot >= 0 && memcmp(_last.data(), record, _recordSize) == 0)
+        {
+            return true;
+        }
+
+        std::vector<uint8_t> slot(_slotSize, 0);
+        SlotHeader header = {};
+        header.magic = CHECKPOINT_MAGIC;
+        header.size = _recordSize;
+        header.sequence = _sequence + 1;
+        header.checksum = checksum(header.sequence, (const uint8_t*)record);
+        memcpy(slot.data(), &header, sizeof(header));
+        memcpy(slot.data() + sizeof(header), record, _recordSize);
+
+        int index = (_slot == 0) ? 1 : 0;
+        if (pwrite(_fd, slot.data(), _slotSize, (off_t)index * _slotSize) != (ssize_t)_slotSize || fdatasync(_fd) != 0)
+        {
+            return false;
+        }
+        _slot = index;
+        _sequence = header.sequence;
+        _last.assign((const uint8_t*)record, (const uint8_t*)record + _recordSize);
+        return true;
+    }
+
+private:
+    struct SlotHeader
+    {
+        uint32_t magic;
+        uint32_t size;
+        uint64_t sequence;
+        uint32_t checksum;
+        uint32_t reserved;
+    };
+
+    bool openFile(bool create)
+    {
+        if (_fd >= 0)
+        {
+            return true;
+        }
+        int fd = open(_path.c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT : 0), 0644);
+        if (fd < 0)
+        {
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0)
+        {
+            close(fd);
+            return false;
+        }
+        /* a new file, or one written with another record size, is sized once */
+        if (st.st_size != (off_t)(2 * _slotSize))
+        {
+            if (ftruncate(fd, 0) != 0 || ftruncate(fd, 2 * _slotSize) != 0 || fsync(fd) != 0)
+            {
+                close(fd);
+                return false;
+            }
+            _slot = -1;
+            _sequence = 0;
+            _fd = fd;
+            return true;
+        }
+        _fd = fd;
+        /* a store without a load first continues after the newest record */
+        scanSlots();
+        return true;
+    }
+
+    /* Finds the newest valid record, _slot is -1 if there is none */
+    void scanSlots()
+    {
+        std::vector<uint8_t> slot(_slotSize);
+        _slot = -1;
+        _sequence = 0;
+        for (int index = 0; index < 2; index++)
+        {
+            if (pread(_fd, slot.data(), _slotSize, (off_t)index * _slotSize) != (ssize_t)_slotSize)
+            {
+                continue;
+            }
+            SlotHeader header;
+            memcpy(&header, slot.data(), sizeof(header));
+            const uint8_t* payload = slot.data() + sizeof(header);
+            if (header.magic != CHECKPOINT_MAGIC || header.size != _recordSize || header.checksum != checksum(header.sequence, payload))
+            {
+                continue;
+            }
+            if (_slot < 0 || header.sequence > _sequence)
+            {
+                _slot = index;
+                _sequence = header.sequence;
+                _last.assign(payload, payload + _recordSize);
+            }
+        }
+    }
+
+    /* FNV-1a over the sequence number and the record */
+    uint32_t checksum(uint64_t sequence, const uint8_t* payload) const
+    {
+        uint32_t hash = 2166136261u;
+        for (int i = 0; i < 8; i++)
+        {
+            hash = (hash ^ (uint8_t)(sequence >> (8 * i))) * 16777619u;
+        }
+        for (uint32_t i = 0; i < _recordSize; i++)
+        {
+            hash = (hash ^ payload[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    std::string _path;
+    uint32_t _recordSize;
+    uint32_t _slotSize;
+    int _fd;
+    uint64_t _sequence;
+    int _slot; /* Slot of the latest record, -1 if none */
+    std::vector<uint8_t> _last;
+    std::mutex _mutex;
+};
+} // namespace Utils
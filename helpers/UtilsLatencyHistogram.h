@@ -0,0 +1,146 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+#define LATENCY_HISTOGRAM_SUB_BITS 3
+#define LATENCY_HISTOGRAM_SUB_BUCKETS (1u << LATENCY_HISTOGRAM_SUB_BITS)
+/* values below SUB_BUCKETS get their own bucket, then SUB_BUCKETS per power of two up to 2^31 */
+#define LATENCY_HISTOGRAM_BUCKETS (LATENCY_HISTOGRAM_SUB_BUCKETS * (32 - LATENCY_HISTOGRAM_SUB_BITS + 1))
+
+namespace Utils
+{
+/**
+* @brief Log-bucketed histogram of 32-bit latency samples.
+*
+* Each power of two is split into LATENCY_HISTOGRAM_SUB_BUCKETS buckets, so a
+* reported percentile is at most 1/8 above the real value while the whole
+* histogram is a fixed array of counters. Recording is lock-free and may be
+* done from any thread; reading while recording gives a slightly stale but
+* consistent-enough view, which is all metrics need.
+*/
+class LatencyHistogram
+{
+public:
+    LatencyHistogram()
+    {
+        reset();
+    }
+
+    LatencyHistogram(const LatencyHistogram&) = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+    /**
+    * @brief Add one sample
+    * @param[in] value - The latency, in whatever unit the caller uses consistently
+    */
+    void record(uint32_t value)
+    {
+        _buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+        _count.fetch_add(1, std::memory_order_relaxed);
+        uint32_t max = _max.load(std::memory_order_relaxed);
+        while ((value > max) && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    uint64_t count() const
+    {
+        return _count.load(std::memory_order_relaxed);
+    }
+
+    uint32_t max() const
+    {
+        return _max.load(std::memory_order_relaxed);
+    }
+
+    /**
+    * @brief Estimate a percentile
+    * @param[in] percent - 0 to 100
+    * @return The upper bound of the bucket holding the percentile, never above max(); 0 if empty
+    */
+    uint32_t percentile(double percent) const
+    {
+        uint64_t total = count();
+        if (total == 0)
+        {
+            return 0;
+        }
+        uint64_t rank = (uint64_t)((percent / 100.0) * total + 0.999999);
+        if (rank < 1)
+        {
+            rank = 1;
+        }
+
+        uint64_t seen = 0;
+        for (uint32_t index = 0; index < LATENCY_HISTOGRAM_BUCKETS; index++)
+        {
+            seen += _buckets[index].load(std::memory_order_relaxed);
+            if (seen >= rank)
+            {
+                uint32_t upper = upperBoundOf(index);
+                uint32_t largest = max();
+                return (upper < largest) ? upper : largest;
+            }
+        }
+        return max();
+    }
+
+    void reset()
+    {
+        for (auto& bucket : _buckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        _count.store(0, std::memory_order_relaxed);
+        _max.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static uint32_t bucketOf(uint32_t value)
+    {
+        if (value < LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return value;
+        }
+        uint32_t exponent = 31 - __builtin_clz(value);
+        uint32_t shift = exponent - LATENCY_HISTOGRAM_SUB_BITS;
+        return LATENCY_HISTOGRAM_SUB_BUCKETS * (shift + 1) + ((value >> shift) - LATENCY_HISTOGRAM_SUB_BUCKETS);
+    }
+
+    static uint32_t upperBoundOf(uint32_t index)
+    {
+        if (index < LATENCY_HISTOGRAM_SUB_BUCKETS)
+        {
+            return index;
+        }
+        uint32_t shift = (index / LATENCY_HISTOGRAM_SUB_BUCKETS) - 1;
+        uint64_t lower = (uint64_t)(LATENCY_HISTOGRAM_SUB_BUCKETS + (index % LATENCY_HISTOGRAM_SUB_BUCKETS)) << shift;
+        uint64_t upper = lower + (1ull << shift) - 1;
+        return (upper > UINT32_MAX) ? UINT32_MAX : (uint32_t)upper;
+    }
+
+    std::atomic<uint64_t> _buckets[LATENCY_HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> _count;
+    std::atomic<uint32_t> _max;
+};
+} // namespace Utils
@@ -21,9 +21,18 @@
 
 #include <syscall.h>
 
+#ifdef ENABLE_ASYNC_LOGGING
+#include "UtilsAsyncLog.h"
+
+/* Formatted on the caller's thread, written by the Utils::AsyncLog writer once started */
+#define LOGINFO(fmt, ...) Utils::AsyncLog::instance().log(Utils::AsyncLog::stderrSink, ASYNC_LOG_PRIORITY_INFO, "[%d] INFO [%s:%d] %s: " fmt, Utils::AsyncLog::threadId(), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define LOGWARN(fmt, ...) Utils::AsyncLog::instance().log(Utils::AsyncLog::stderrSink, ASYNC_LOG_PRIORITY_WARNING, "[%d] WARN [%s:%d] %s: " fmt, Utils::AsyncLog::threadId(), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define LOGERR(fmt, ...) Utils::AsyncLog::instance().log(Utils::AsyncLog::stderrSink, ASYNC_LOG_PRIORITY_ERR, "[%d] ERROR [%s:%d] %s: " fmt, Utils::AsyncLog::threadId(), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#else
 #define LOGINFO(fmt, ...) do { fprintf(stderr, "[%d] INFO [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
 #define LOGWARN(fmt, ...) do { fprintf(stderr, "[%d] WARN [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
 #define LOGERR(fmt, ...) do { fprintf(stderr, "[%d] ERROR [%s:%d] %s: " fmt "\n", (int)syscall(SYS_gettid), WPEFramework::Core::FileNameOnly(__FILE__), __LINE__, __FUNCTION__, ##__VA_ARGS__); fflush(stderr); } while (0)
+#endif /* ENABLE_ASYNC_LOGGING */
 
 #define LOG_DEVICE_EXCEPTION0() LOGWARN("Exception caught: code=%d message=%s", err.getCode(), err.what());
 #define LOG_DEVICE_EXCEPTION1(param1) LOGWARN("Exception caught" #param1 "=%s code=%d message=%s", param1.c_str(), err.getCode(), err.what());
@@ -0,0 +1,417 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <linux/cn_proc.h>
+#include <linux/connector.h>
+#include <linux/netlink.h>
+
+namespace Utils
+{
+/**
+* @brief Index of the processes whose command line contains one of a set of names.
+*
+* The index is kept current from fork, exec and exit events of the netlink
+* process connector, so a lookup does not scan /proc. Processes forked by an
+* indexed process are kept as its descendants until they exit. The index is
+* seeded by one /proc scan when it is opened, and rebuilt by another if the
+* kernel reports lost events. Without the connector (it needs CAP_NET_ADMIN)
+* or for a name that is not indexed, find() scans /proc as before.
+*/
+class ProcessIndex
+{
+public:
+    /**
+    * @param[in] names - Names to index; a process matches when an argument contains one
+    */
+    explicit ProcessIndex(const std::vector<std::string>& names)
+        : _names(names)
+        , _fd(-1)
+    {
+    }
+
+    ~ProcessIndex()
+    {
+        close();
+    }
+
+    ProcessIndex(const ProcessIndex&) = delete;
+    ProcessIndex& operator=(const ProcessIndex&) = delete;
+
+    /**
+    * @brief Subscribe to process events and seed the index
+    * @return The descriptor to poll for events, passed to dispatch(); -1 if the connector is unavailable
+    */
+    int open()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_fd >= 0)
+        {
+            return _fd;
+        }
+
+        int fd = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK, NETLINK_CONNECTOR);
+        if (fd < 0)
+        {
+            return -1;
+        }
+        struct sockaddr_nl address = {};
+        address.nl_family = AF_NETLINK;
+        address.nl_groups = CN_IDX_PROC;
+        if ((bind(fd, (struct sockaddr*)&address, sizeof(address)) < 0) || !subscribe(fd, PROC_CN_MCAST_LISTEN))
+        {
+            ::close(fd);
+            return -1;
+        }
+
+        /* events from here on are queued on fd, so the scan misses nothing */
+        _fd = fd;
+        scanLocked();
+        return _fd;
+    }
+
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_fd >= 0)
+        {
+            subscribe(_fd, PROC_CN_MCAST_IGNORE);
+            ::close(_fd);
+            _fd = -1;
+        }
+        _processes.clear();
+        _byName.clear();
+    }
+
+    /**
+    * @brief Replace the names to index; an open index is seeded again
+    */
+    void setNames(const std::vector<std::string>& names)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _names = names;
+        if (_fd >= 0)
+        {
+            scanLocked();
+        }
+    }
+
+    bool listening()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return (_fd >= 0);
+    }
+
+    /**
+    * @brief Apply the events queued on the descriptor returned by open()
+    */
+    void dispatch()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_fd < 0)
+        {
+            return;
+        }
+
+        alignas(struct nlmsghdr) char buffer[4096];
+        for (;;)
+        {
+            struct sockaddr_nl sender = {};
+            socklen_t senderLength = sizeof(sender);
+            ssize_t length = recvfrom(_fd, buffer, sizeof(buffer), 0, (struct sockaddr*)&sender, &senderLength);
+            if (length < 0)
+            {
+                if (errno == ENOBUFS)
+                {
+                    /* the kernel dropped events: start over from /proc */
+                    scanLocked();
+                    continue;
+                }
+                break;
+            }
+            if (sender.nl_pid != 0)
+            {
+                continue; /* only the kernel reports process events */
+            }
+
+            for (struct nlmsghdr* header = (struct nlmsghdr*)buffer; NLMSG_OK(header, (size_t)length); header = NLMSG_NEXT(header, length))
+            {
+                if (header->nlmsg_type == NLMSG_ERROR || header->nlmsg_type == NLMSG_NOOP)
+                {
+                    continue;
+                }
+                struct cn_msg* message = (struct cn_msg*)NLMSG_DATA(header);
+                if (message->id.idx != CN_IDX_PROC || message->id.val != CN_VAL_PROC)
+                {
+                    continue;
+                }
+                onEvent(*(struct proc_event*)message->data);
+            }
+        }
+    }
+
+    /**
+    * @brief Find a process whose command line contains name
+    * @return Its pid, or -1 if there is none
+    */
+    pid_t find(const std::string& name)
+    {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (_fd >= 0 && isIndexed(name))
+        {
+            auto it = _byName.find(name);
+            return (it != _byName.end() && !it->second.matched.empty()) ? *it->second.matched.begin() : (pid_t)-1;
+        }
+        lock.unlock();
+        return scanFor(name);
+    }
+
+    /**
+    * @brief The processes forked by the processes matching name, and by those in turn
+    * @return Their pids; empty for a name that is not indexed or without the connector
+    */
+    std::vector<pid_t> descendants(const std::string& name)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _byName.find(name);
+        if (_fd < 0 || it == _byName.end())
+        {
+            return std::vector<pid_t>();
+        }
+        return std::vector<pid_t>(it->second.descendants.begin(), it->second.descendants.end());
+    }
+
+private:
+    struct Entry
+    {
+        std::string name;
+        bool matched; /* false for a descendant */
+    };
+
+    struct Processes
+    {
+        std::set<pid_t> matched;
+        std::set<pid_t> descendants;
+    };
+
+    bool isIndexed(const std::string& name) const
+    {
+        for (const auto& indexed : _names)
+        {
+            if (indexed == name)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool subscribe(int fd, enum proc_cn_mcast_op operation)
+    {
+        alignas(struct nlmsghdr) char buffer[NLMSG_SPACE(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op))] = {};
+        struct nlmsghdr* header = (struct nlmsghdr*)buffer;
+        struct cn_msg* message = (struct cn_msg*)NLMSG_DATA(header);
+
+        header->nlmsg_len = NLMSG_LENGTH(sizeof(struct cn_msg) + sizeof(enum proc_cn_mcast_op));
+        header->nlmsg_type = NLMSG_DONE;
+        message->id.idx = CN_IDX_PROC;
+        message->id.val = CN_VAL_PROC;
+        message->len = sizeof(enum proc_cn_mcast_op);
+        memcpy(message->data, &operation, sizeof(operation));
+        return (send(fd, header, header->nlmsg_len, 0) == (ssize_t)header->nlmsg_len);
+    }
+
+    /* Calls match for each argument of pid until it returns true */
+    template <typename MATCH>
+    static bool forEachArgument(pid_t pid, MATCH match)
+    {
+        char path[64];
+        snprintf(path, sizeof(path), "/proc/%d/cmdline", (int)pid);
+        FILE* fp = fopen(path, "re");
+        if (fp == nullptr)
+        {
+            return false;
+        }
+        bool found = false;
+        char* argument = nullptr;
+        size_t size = 0;
+        while (!found && getdelim(&argument, &size, 0, fp) != -1)
+        {
+            found = match(argument);
+        }
+        free(argument);
+        fclose(fp);
+        return found;
+    }
+
+    template <typename VISIT>
+    static void forEachProcess(VISIT visit)
+    {
+        DIR* dir = opendir("/proc");
+        if (dir == nullptr)
+        {
+            return;
+        }
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != nullptr)
+        {
+            char* end = nullptr;
+            long pid = strtol(entry->d_name, &end, 10);
+            if (*end == '\0' && pid > 0 && !visit((pid_t)pid))
+            {
+                break;
+            }
+        }
+        closedir(dir);
+    }
+
+    static pid_t scanFor(const std::string& name)
+    {
+        pid_t found = -1;
+        forEachProcess([&](pid_t pid) {
+            if (forEachArgument(pid, [&](const char* argument) { return strstr(argument, name.c_str()) != nullptr; }))
+            {
+                found = pid;
+                return false;
+            }
+            return true;
+        });
+        return found;
+    }
+
+    /* The indexed name in the command line of pid, empty if none */
+    std::string matchingName(pid_t pid) const
+    {
+        std::string name;
+        forEachArgument(pid, [&](const char* argument) {
+            for (const auto& indexed : _names)
+            {
+                if (strstr(argument, indexed.c_str()) != nullptr)
+                {
+                    name = indexed;
+                    return true;
+                }
+            }
+            return false;
+        });
+        return name;
+    }
+
+    void add(pid_t pid, const std::string& name, bool matched)
+    {
+        remove(pid);
+        _processes[pid] = Entry{ name, matched };
+        Processes& processes = _byName[name];
+        (matched ? processes.matched : processes.descendants).insert(pid);
+    }
+
+    void remove(pid_t pid)
+    {
+        auto it = _processes.find(pid);
+        if (it != _processes.end())
+        {
+            Processes& processes = _byName[it->second.name];
+            (it->second.matched ? processes.matched : processes.descendants).erase(pid);
+            _processes.erase(it);
+        }
+    }
+
+    /* Descendants of processes started before the scan are not known */
+    void scanLocked()
+    {
+        _processes.clear();
+        _byName.clear();
+        forEachProcess([this](pid_t pid) {
+            std::string name = matchingName(pid);
+            if (!name.empty())
+            {
+                add(pid, name, true);
+            }
+            return true;
+        });
+    }
+
+    void onEvent(const struct proc_event& event)
+    {
+        switch (event.what)
+        {
+        case proc_event::PROC_EVENT_FORK:
+            /* threads are reported as forks too */
+            if (event.event_data.fork.child_pid == event.event_data.fork.child_tgid)
+            {
+                auto parent = _processes.find(event.event_data.fork.parent_tgid);
+                if (parent != _processes.end())
+                {
+                    add(event.event_data.fork.child_tgid, parent->second.name, false);
+                }
+            }
+            break;
+        case proc_event::PROC_EVENT_EXEC:
+        {
+            pid_t pid = event.event_data.exec.process_tgid;
+            std::string name = matchingName(pid);
+            if (!name.empty())
+            {
+                add(pid, name, true);
+            }
+            else
+            {
+                auto it = _processes.find(pid);
+                if (it != _processes.end() && it->second.matched)
+                {
+                    /* exec'ed something else: no longer matches */
+                    remove(pid);
+                }
+            }
+            break;
+        }
+        case proc_event::PROC_EVENT_EXIT:
+            if (event.event_data.exit.process_pid == event.event_data.exit.process_tgid)
+            {
+                remove(event.event_data.exit.process_tgid);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+
+    std::vector<std::string> _names;
+    std::mutex _mutex;
+    int _fd;
+    std::unordered_map<pid_t, Entry> _processes;
+    std::map<std::string, Processes> _byName;
+};
+} // namespace Utils
@@ -0,0 +1,202 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <string>
+#include <mutex>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define RECORD_RING_MAGIC 0x52524E47 /* "RRNG" */
+#define RECORD_RING_VERSION 1
+
+namespace Utils
+{
+/**
+* @brief Fixed-capacity ring of fixed-size records kept in a file.
+*
+* The file holds a header followed by one slot per record, so its size never
+* changes once created. Appending writes one slot and the header; reading
+* fetches one slot, so callers can page through the ring without loading it.
+* Each slot carries its sequence number, so a slot whose header update was
+* lost in a crash is detected instead of being returned as a different record.
+* A file created with another record size or capacity is reset. Writes are
+* not synced; losing the last records on power loss is acceptable.
+*/
+class RecordRing
+{
+public:
+    /**
+    * @param[in] path - The file holding the ring, created on first append
+    * @param[in] recordSize - The size of each record in bytes
+    * @param[in] capacity - The number of records kept; older ones are overwritten
+    */
+    RecordRing(const std::string& path, uint32_t recordSize, uint32_t capacity)
+        : _path(path)
+        , _fd(-1)
+    {
+        memset(&_header, 0, sizeof(_header));
+        _header.magic = RECORD_RING_MAGIC;
+        _header.version = RECORD_RING_VERSION;
+        _header.recordSize = recordSize;
+        _header.capacity = capacity;
+    }
+
+    ~RecordRing()
+    {
+        if (_fd >= 0)
+        {
+            close(_fd);
+        }
+    }
+
+    RecordRing(const RecordRing&) = delete;
+    RecordRing& operator=(const RecordRing&) = delete;
+
+    /**
+    * @brief Append a record, overwriting the oldest one when the ring is full
+    * @param[in] record - recordSize bytes
+    * @return true if the record was written
+    */
+    bool append(const void* record)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!openLocked(true))
+        {
+            return false;
+        }
+
+        uint64_t sequence = _header.next;
+        off_t offset = slotOffset(sequence);
+        if ((pwrite(_fd, &sequence, sizeof(sequence), offset) != sizeof(sequence)) ||
+            (pwrite(_fd, record, _header.recordSize, offset + sizeof(sequence)) != (ssize_t)_header.recordSize))
+        {
+            return false;
+        }
+        _header.next = sequence + 1;
+        return (pwrite(_fd, &_header, sizeof(_header), 0) == sizeof(_header));
+    }
+
+    /**
+    * @return The number of records that can be read, at most capacity
+    */
+    uint32_t count()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!openLocked(false))
+        {
+            return 0;
+        }
+        return (_header.next < _header.capacity) ? (uint32_t)_header.next : _header.capacity;
+    }
+
+    /**
+    * @brief Read a record, newest first
+    * @param[in] index - 0 for the newest record, count() - 1 for the oldest
+    * @param[out] record - recordSize bytes
+    * @param[out] sequence - The number of records appended before this one, optional
+    * @return true if the record was read
+    */
+    bool read(uint32_t index, void* record, uint64_t* sequence = nullptr)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!openLocked(false) || index >= _header.capacity || index >= _header.next)
+        {
+            return false;
+        }
+
+        uint64_t expected = _header.next - 1 - index;
+        uint64_t stored = 0;
+        off_t offset = slotOffset(expected);
+        if ((pread(_fd, &stored, sizeof(stored), offset) != sizeof(stored)) || (stored != expected) ||
+            (pread(_fd, record, _header.recordSize, offset + sizeof(stored)) != (ssize_t)_header.recordSize))
+        {
+            return false;
+        }
+        if (sequence != nullptr)
+        {
+            *sequence = stored;
+        }
+        return true;
+    }
+
+private:
+    struct Header
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t recordSize;
+        uint32_t capacity;
+        uint64_t next; /* sequence number of the next record */
+    };
+
+    off_t slotOffset(uint64_t sequence) const
+    {
+        return (off_t)sizeof(Header) + (off_t)(sequence % _header.capacity) * (off_t)(sizeof(uint64_t) + _header.recordSize);
+    }
+
+    bool openLocked(bool create)
+    {
+        if (_fd >= 0)
+        {
+            return true;
+        }
+        if (_header.recordSize == 0 || _header.capacity == 0)
+        {
+            return false;
+        }
+
+        int fd = ::open(_path.c_str(), O_RDWR | O_CLOEXEC | (create ? O_CREAT : 0), 0644);
+        if (fd < 0)
+        {
+            return false;
+        }
+
+        Header stored;
+        if ((pread(fd, &stored, sizeof(stored), 0) == sizeof(stored)) &&
+            (stored.magic == RECORD_RING_MAGIC) && (stored.version == RECORD_RING_VERSION) &&
+            (stored.recordSize == _header.recordSize) && (stored.capacity == _header.capacity))
+        {
+            _header.next = stored.next;
+        }
+        else
+        {
+            /* New file, or one from another layout: start over */
+            off_t size = (off_t)sizeof(Header) + (off_t)_header.capacity * (off_t)(sizeof(uint64_t) + _header.recordSize);
+            _header.next = 0;
+            if ((ftruncate(fd, 0) != 0) || (ftruncate(fd, size) != 0) ||
+                (pwrite(fd, &_header, sizeof(_header), 0) != sizeof(_header)))
+            {
+                close(fd);
+                return false;
+            }
+        }
+        _fd = fd;
+        return true;
+    }
+
+    std::string _path;
+    std::mutex _mutex;
+    int _fd;
+    Header _header;
+};
+} // namespace Utils
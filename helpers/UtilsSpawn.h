@@ -0,0 +1,313 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <spawn.h>
+#include <signal.h>
+#include <unistd.h>
+#include <linux/sched.h>
+#include <sys/resource.h>
+#include <sys/types.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+namespace Utils
+{
+/**
+* @brief Open a pidfd referring to the given process
+* @param[in] pid - The process ID
+* @return The pidfd, or -1 with errno set if the kernel does not support pidfds
+*/
+inline int pidfdOpen(pid_t pid)
+{
+#if defined(SYS_pidfd_open)
+    return static_cast<int>(syscall(SYS_pidfd_open, pid, 0));
+#else
+    (void)pid;
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+/**
+* @brief Signals a started program gets back at their default action
+*/
+inline void defaultSignals(sigset_t& set)
+{
+    sigemptyset(&set);
+    sigaddset(&set, SIGPIPE);
+    sigaddset(&set, SIGCHLD);
+    sigaddset(&set, SIGHUP);
+    sigaddset(&set, SIGINT);
+    sigaddset(&set, SIGTERM);
+    sigaddset(&set, SIGUSR1);
+    sigaddset(&set, SIGABRT);
+}
+
+/**
+* @brief Child side of spawnInCgroup(): what posix_spawn() does before the exec, with async-signal-safe calls only
+* @param[in] argv - The program and its arguments
+* @param[in] errorFd - Where the errno of a failure is written; closed by a successful exec
+* @param[in] procsFd - cgroup.procs of the group to move into first, or -1 if already there
+*/
+[[noreturn]] inline void execChild(char* const argv[], int errorFd, int procsFd)
+{
+    int error = 0;
+    if (procsFd >= 0 && write(procsFd, "0", 1) != 1)
+    {
+        error = errno;
+    }
+    else if (setpgid(0, 0) != 0)
+    {
+        error = errno;
+    }
+    else
+    {
+        sigset_t defaults;
+        defaultSignals(defaults);
+        struct sigaction action = {};
+        action.sa_handler = SIG_DFL;
+        for (int sig = 1; sig < NSIG; sig++)
+        {
+            if (sigismember(&defaults, sig) == 1)
+            {
+                sigaction(sig, &action, nullptr);
+            }
+        }
+        sigset_t mask;
+        sigemptyset(&mask);
+        sigprocmask(SIG_SETMASK, &mask, nullptr);
+        execve(argv[0], argv, environ);
+        error = errno;
+    }
+    while (write(errorFd, &error, sizeof(error)) < 0 && errno == EINTR)
+    {
+    }
+    _exit(127);
+}
+
+/**
+* @brief Start a program in a cgroup v2 group, which it is in before it runs
+*
+* clone3() with CLONE_INTO_CGROUP creates the child in the group. Kernels
+* before 5.7 lack it; there the child is forked and moves itself into the
+* group before the exec. Either way the program and whatever it starts
+* never run outside the group.
+*
+* @return 0 on success, otherwise an errno value
+*/
+inline int spawnInCgroup(char* const argv[], pid_t& pid, int cgroupFd)
+{
+    int fds[2];
+    if (pipe2(fds, O_CLOEXEC) != 0)
+    {
+        return errno;
+    }
+
+    pid_t child = -1;
+#if defined(SYS_clone3) && defined(CLONE_INTO_CGROUP)
+    struct clone_args args;
+    memset(&args, 0, sizeof(args));
+    args.flags = CLONE_INTO_CGROUP;
+    args.exit_signal = SIGCHLD;
+    args.cgroup = (uint64_t)cgroupFd;
+    child = (pid_t)syscall(SYS_clone3, &args, sizeof(args));
+    if (child == 0)
+    {
+        execChild(argv, fds[1], -1);
+    }
+#else
+    errno = ENOSYS;
+#endif
+    if (child < 0 && (errno == ENOSYS || errno == E2BIG))
+    {
+        int procsFd = openat(cgroupFd, "cgroup.procs", O_WRONLY | O_CLOEXEC);
+        if (procsFd >= 0)
+        {
+            child = fork();
+            if (child == 0)
+            {
+                execChild(argv, fds[1], procsFd);
+            }
+            int forkError = errno;
+            close(procsFd);
+            errno = forkError;
+        }
+    }
+
+    int error = (child < 0) ? errno : 0;
+    close(fds[1]);
+    if (child > 0)
+    {
+        /* nothing to read once the exec has closed the pipe */
+        int childError = 0;
+        ssize_t len;
+        while ((len = read(fds[0], &childError, sizeof(childError))) < 0 && errno == EINTR)
+        {
+        }
+        if (len == (ssize_t)sizeof(childError))
+        {
+            waitpid(child, nullptr, 0);
+            error = childError;
+        }
+        else
+        {
+            pid = child;
+        }
+    }
+    close(fds[0]);
+    return error;
+}
+
+/**
+* @brief Start a program in the background in its own process group, equivalent to "command &" without the shell
+* @param[in] command - Absolute path of the program followed by whitespace separated arguments
+* @param[out] pid - The process ID of the child, which is also its process group ID
+* @param[in] cgroupFd - Directory of the cgroup v2 group to start the program in, -1 for the caller's
+* @return 0 on success, otherwise an errno value
+*/
+inline int spawnProcess(const std::string& command, pid_t& pid, int cgroupFd = -1)
+{
+    std::istringstream stream(command);
+    std::vector<std::string> args;
+    std::string arg;
+    while (stream >> arg)
+    {
+        args.push_back(arg);
+    }
+    if (args.empty())
+    {
+        return EINVAL;
+    }
+
+    std::vector<char*> argv;
+    for (auto& item : args)
+    {
+        argv.push_back(&item[0]);
+    }
+    argv.push_back(nullptr);
+
+    if (cgroupFd >= 0)
+    {
+        return spawnInCgroup(argv.data(), pid, cgroupFd);
+    }
+
+    posix_spawnattr_t attr;
+    int ret = posix_spawnattr_init(&attr);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    /* The child must not inherit the caller's blocked or ignored signals */
+    sigset_t mask;
+    sigset_t defaults;
+    sigemptyset(&mask);
+    defaultSignals(defaults);
+
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+    posix_spawnattr_setpgroup(&attr, 0);
+    posix_spawnattr_setsigmask(&attr, &mask);
+    posix_spawnattr_setsigdefault(&attr, &defaults);
+
+    ret = posix_spawn(&pid, argv[0], nullptr, &attr, argv.data(), environ);
+    posix_spawnattr_destroy(&attr);
+    return ret;
+}
+
+/**
+* @brief Resources used by a process and the children it waited for
+*/
+struct ProcessUsage
+{
+    uint64_t cpuUserMs;
+    uint64_t cpuSystemMs;
+    uint64_t maxRssKb;          /* largest resident set of the process or of one child */
+    uint64_t readBytes;         /* read through read(2) and the like, sockets and pipes included */
+    uint64_t writeBytes;        /* written through write(2) and the like, sockets and pipes included */
+    uint64_t storageReadBytes;  /* fetched from storage, page cache hits excluded */
+    uint64_t storageWriteBytes; /* sent to storage, or to the page cache to be written back */
+    uint64_t memoryPeakKb;      /* largest memory use of the process's cgroup, page cache included; not set by waitProcess() */
+};
+
+/**
+* @brief Reap an exited child like waitpid(), collecting what it used
+* @param[in] pid - The child
+* @param[out] status - Its wait status
+* @param[in] options - 0 or WNOHANG
+* @param[out] usage - Filled in when the child is reaped; the byte counts stay 0 without /proc/<pid>/io
+* @return pid once reaped, 0 if it is still running with WNOHANG, -1 with errno set on error
+*/
+inline pid_t waitProcess(pid_t pid, int& status, int options, ProcessUsage& usage)
+{
+    /* /proc/<pid>/io is gone once the child is reaped, so wait without reaping first */
+    siginfo_t info = {};
+    if (waitid(P_PID, pid, &info, WEXITED | WNOWAIT | (options & WNOHANG)) != 0)
+    {
+        return -1;
+    }
+    if (info.si_pid == 0)
+    {
+        return 0;
+    }
+
+    memset(&usage, 0, sizeof(usage));
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/io", (int)pid);
+    FILE* fp = fopen(path, "re");
+    if (fp != nullptr)
+    {
+        char name[32];
+        uint64_t value;
+        while (fscanf(fp, "%31[^:]: %" SCNu64 " ", name, &value) == 2)
+        {
+            if (strcmp(name, "rchar") == 0)
+                usage.readBytes = value;
+            else if (strcmp(name, "wchar") == 0)
+                usage.writeBytes = value;
+            else if (strcmp(name, "read_bytes") == 0)
+                usage.storageReadBytes = value;
+            else if (strcmp(name, "write_bytes") == 0)
+                usage.storageWriteBytes = value;
+        }
+        fclose(fp);
+    }
+
+    struct rusage rusage = {};
+    pid_t ret = wait4(pid, &status, 0, &rusage);
+    if (ret == pid)
+    {
+        usage.cpuUserMs = (uint64_t)rusage.ru_utime.tv_sec * 1000 + rusage.ru_utime.tv_usec / 1000;
+        usage.cpuSystemMs = (uint64_t)rusage.ru_stime.tv_sec * 1000 + rusage.ru_stime.tv_usec / 1000;
+        usage.maxRssKb = (uint64_t)rusage.ru_maxrss;
+    }
+    return ret;
+}
+} // namespace Utils
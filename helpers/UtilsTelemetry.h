@@ -19,6 +19,8 @@
 
 #pragma once
 
+#include "UtilsTelemetryBatcher.h"
+
 // telemetry
 #ifdef ENABLE_TELEMETRY_LOGGING
 #include <telemetry_busmessage_sender.h>
@@ -35,17 +37,30 @@ namespace Utils
 #endif
         };
 
+        /**
+         * @brief Queue the events of this process go through, so that a caller
+         *        never waits on the telemetry bus; started on first use.
+         *        Text values are cut to TELEMETRY_VALUE_SIZE - 1 characters.
+         */
+        static TelemetryBatcher& batcher()
+        {
+            static TelemetryBatcher instance(sendCounter, sendValue);
+            static bool started = (instance.start(), true);
+            (void)started;
+            return instance;
+        }
+
         static void sendMessage(char* message)
         {
 #ifdef ENABLE_TELEMETRY_LOGGING
-            t2_event_s((char *)"THUNDER_MESSAGE", message);
+            batcher().message("THUNDER_MESSAGE", message);
 #endif
         };
 
         static void sendMessage(char *marker, char* message)
         {
 #ifdef ENABLE_TELEMETRY_LOGGING
-            t2_event_s(marker, message);
+            batcher().message(marker, message);
 #endif
         };
 
@@ -58,13 +73,29 @@ namespace Utils
             WPEFramework::Trace::Format(message, format, parameters);
             va_end(parameters);
 
-            // get rid of const for t2_event_s
-            char* error = strdup(message.c_str());
-            t2_event_s((char *)"THUNDER_ERROR", error);
-            if (error)
-            {
-                free(error);
-            }
+            batcher().message("THUNDER_ERROR", message.c_str());
+#endif
+        };
+
+    private:
+        /* Called from the flusher thread of batcher(); L1 tests leave the T2 mocks alone */
+        static void sendCounter(const char* marker, int value)
+        {
+#if defined(ENABLE_TELEMETRY_LOGGING) && !defined(GTEST_ENABLE)
+            t2_event_d((char *)marker, value);
+#else
+            (void)marker;
+            (void)value;
+#endif
+        };
+
+        static void sendValue(const char* marker, const char* value)
+        {
+#if defined(ENABLE_TELEMETRY_LOGGING) && !defined(GTEST_ENABLE)
+            t2_event_s((char *)marker, (char *)value);
+#else
+            (void)marker;
+            (void)value;
 #endif
         };
     };
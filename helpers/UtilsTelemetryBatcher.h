@@ -0,0 +1,283 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#define TELEMETRY_QUEUE_SIZE            128 /* must be a power of two */
+#define TELEMETRY_MARKER_SIZE           64
+#define TELEMETRY_VALUE_SIZE            128
+#define TELEMETRY_FLUSH_INTERVAL_MS     10000
+
+namespace Utils
+{
+/**
+* @brief Queues telemetry events and sends them in batches from a background thread.
+*
+* count() and message() copy the event into a bounded lock-free queue and
+* return; they never block, allocate or wake the flusher. Every flush interval
+* the flusher drains the queue, sums the counters of each marker into one
+* event and forwards text events in order. When the queue is full the event
+* is dropped and counted in dropped().
+*/
+class TelemetryBatcher
+{
+public:
+    typedef std::function<void(const char* marker, int value)> CounterSink;
+    typedef std::function<void(const char* marker, const char* value)> MessageSink;
+
+    /**
+    * @param[in] counterSink - Sends a counter, e.g. t2_event_d
+    * @param[in] messageSink - Sends a text value, e.g. t2_event_s
+    * @param[in] intervalMs - Time between two flushes of the background thread
+    */
+    TelemetryBatcher(CounterSink counterSink, MessageSink messageSink, uint32_t intervalMs = TELEMETRY_FLUSH_INTERVAL_MS)
+        : _counterSink(counterSink)
+        , _messageSink(messageSink)
+        , _interval(intervalMs)
+        , _enqueuePos(0)
+        , _dequeuePos(0)
+        , _dropped(0)
+        , _delivered(0)
+        , _running(false)
+    {
+        for (size_t i = 0; i < TELEMETRY_QUEUE_SIZE; i++)
+        {
+            _cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~TelemetryBatcher()
+    {
+        stop();
+    }
+
+    TelemetryBatcher(const TelemetryBatcher&) = delete;
+    TelemetryBatcher& operator=(const TelemetryBatcher&) = delete;
+
+    void start()
+    {
+        std::lock_guard<std::mutex> lock(_threadMutex);
+        if (!_running)
+        {
+            _running = true;
+            _flusher = std::thread(&TelemetryBatcher::run, this);
+        }
+    }
+
+    /**
+    * @brief Stop the background thread and send what is still queued
+    */
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(_threadMutex);
+            if (!_running)
+            {
+                return;
+            }
+            _running = false;
+        }
+        _wakeup.notify_all();
+        if (_flusher.joinable())
+        {
+            _flusher.join();
+        }
+        flush();
+    }
+
+    /**
+    * @brief Queue a counter increment
+    * @return false if the queue was full and the event was dropped
+    */
+    bool count(const char* marker, int value = 1)
+    {
+        return push(marker, value, nullptr);
+    }
+
+    /**
+    * @brief Queue a text event; the value is truncated to TELEMETRY_VALUE_SIZE - 1 characters
+    * @return false if the queue was full and the event was dropped
+    */
+    bool message(const char* marker, const char* value)
+    {
+        return push(marker, 0, (value != nullptr) ? value : "");
+    }
+
+    /**
+    * @brief Drain the queue and send the batch now
+    */
+    void flush()
+    {
+        std::lock_guard<std::mutex> lock(_flushMutex);
+        std::map<std::string, int64_t> counters;
+        Cell* cell = nullptr;
+
+        while ((cell = front()) != nullptr)
+        {
+            if (cell->isMessage)
+            {
+                /* keep text events ordered against the counters queued before them */
+                sendCounters(counters);
+                if (_messageSink)
+                {
+                    _messageSink(cell->marker, cell->value);
+                }
+            }
+            else
+            {
+                counters[cell->marker] += cell->count;
+            }
+            pop(cell);
+            _delivered.fetch_add(1, std::memory_order_relaxed);
+        }
+        sendCounters(counters);
+    }
+
+    /**
+    * @return The number of events dropped because the queue was full
+    */
+    uint64_t dropped() const
+    {
+        return _dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+    * @return The number of events handed to the sinks, before aggregation
+    */
+    uint64_t delivered() const
+    {
+        return _delivered.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        bool isMessage;
+        int count;
+        char marker[TELEMETRY_MARKER_SIZE];
+        char value[TELEMETRY_VALUE_SIZE];
+    };
+
+    /* Bounded MPMC queue (Vyukov); only flush() consumes, serialized by _flushMutex */
+    bool push(const char* marker, int count, const char* value)
+    {
+        size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell = nullptr;
+        for (;;)
+        {
+            cell = &_cells[pos & (TELEMETRY_QUEUE_SIZE - 1)];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            else
+            {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        strncpy(cell->marker, marker, TELEMETRY_MARKER_SIZE - 1);
+        cell->marker[TELEMETRY_MARKER_SIZE - 1] = '\0';
+        cell->count = count;
+        cell->isMessage = (value != nullptr);
+        if (cell->isMessage)
+        {
+            strncpy(cell->value, value, TELEMETRY_VALUE_SIZE - 1);
+            cell->value[TELEMETRY_VALUE_SIZE - 1] = '\0';
+        }
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    Cell* front()
+    {
+        Cell* cell = &_cells[_dequeuePos & (TELEMETRY_QUEUE_SIZE - 1)];
+        return (cell->sequence.load(std::memory_order_acquire) == _dequeuePos + 1) ? cell : nullptr;
+    }
+
+    void pop(Cell* cell)
+    {
+        cell->sequence.store(_dequeuePos + TELEMETRY_QUEUE_SIZE, std::memory_order_release);
+        _dequeuePos++;
+    }
+
+    void sendCounters(std::map<std::string, int64_t>& counters)
+    {
+        if (_counterSink)
+        {
+            for (const auto& counter : counters)
+            {
+                _counterSink(counter.first.c_str(), (counter.second > INT_MAX) ? INT_MAX : (int)counter.second);
+            }
+        }
+        counters.clear();
+    }
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(_threadMutex);
+        while (_running)
+        {
+            _wakeup.wait_for(lock, std::chrono::milliseconds(_interval), [this] { return !_running; });
+            lock.unlock();
+            flush();
+            lock.lock();
+        }
+    }
+
+    CounterSink _counterSink;
+    MessageSink _messageSink;
+    uint32_t _interval;
+
+    Cell _cells[TELEMETRY_QUEUE_SIZE];
+    std::atomic<size_t> _enqueuePos;
+    size_t _dequeuePos;
+    std::atomic<uint64_t> _dropped;
+    std::atomic<uint64_t> _delivered;
+
+    std::mutex _flushMutex;
+    std::mutex _threadMutex;
+    std::condition_variable _wakeup;
+    std::thread _flusher;
+    bool _running;
+};
+} // namespace Utils
@@ -0,0 +1,597 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sys/stat.h>
+
+#define ZONEINFO_DIR "/usr/share/zoneinfo"
+#define ZONEINFO_MAX_FILE_SIZE (1024 * 1024)
+
+namespace Utils
+{
+/**
+* @brief In-process replacement for "TZ=<zone> date", reading compiled tzdata (TZif) files.
+*
+* Zones are resolved like glibc resolves TZ: an empty name is UTC, a name is looked up under
+* TZDIR (default /usr/share/zoneinfo), and a name that is not a zoneinfo file is parsed as a
+* POSIX TZ string. Times past the last transition of a file use the POSIX rule in its footer.
+* Loaded zones are cached and reloaded when the zoneinfo file changes. Leap seconds are ignored.
+*/
+class TimeZone
+{
+public:
+    /**
+    * @brief Get the zone for a TZ value, loading it on first use
+    * @param[in] name - The TZ value, e.g. "America/New_York" or "EST5EDT,M3.2.0,M11.1.0"
+    * @return The zone, never nullptr; unknown zones resolve to UTC
+    */
+    static std::shared_ptr<const TimeZone> Get(const std::string& name)
+    {
+        static std::mutex cacheMutex;
+        static std::map<std::string, std::shared_ptr<const TimeZone>> cache;
+
+        std::string path = filePath(name);
+        std::string stamp;
+        struct stat st;
+        if (!path.empty() && stat(path.c_str(), &st) == 0)
+        {
+            std::ostringstream os;
+            os << st.st_dev << ':' << st.st_ino << ':' << st.st_size << ':' << st.st_mtim.tv_sec << '.' << st.st_mtim.tv_nsec;
+            stamp = os.str();
+        }
+
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto it = cache.find(name);
+        if (it != cache.end() && it->second->_stamp == stamp)
+        {
+            return it->second;
+        }
+
+        std::shared_ptr<TimeZone> zone(new TimeZone());
+        zone->_stamp = stamp;
+        if (!(!stamp.empty() && zone->loadFile(path)))
+        {
+            zone->reset();
+            std::string rule = (!name.empty() && name[0] == ':') ? name.substr(1) : name;
+            if (!zone->parseRule(rule))
+            {
+                zone->reset();
+            }
+        }
+        cache[name] = zone;
+        return zone;
+    }
+
+    /**
+    * @brief Get the UTC offset in effect at an instant
+    * @param[in] utc - Seconds since the epoch
+    * @param[out] isdst - Whether daylight saving time is in effect, may be nullptr
+    * @return Offset east of UTC in seconds
+    */
+    int32_t offsetAt(int64_t utc, bool* isdst = nullptr) const
+    {
+        const Type* type = nullptr;
+        if (_transitions.empty() || utc < _transitions.front())
+        {
+            if (!_transitions.empty() || !_hasRule)
+            {
+                type = &_types[0];
+            }
+        }
+        else if (utc < _transitions.back() || !_hasRule)
+        {
+            size_t i = std::upper_bound(_transitions.begin(), _transitions.end(), utc) - _transitions.begin() - 1;
+            type = &_types[_typeIndex[i]];
+        }
+
+        if (type == nullptr)
+        {
+            return ruleOffsetAt(utc, isdst);
+        }
+        if (isdst != nullptr)
+        {
+            *isdst = type->isdst;
+        }
+        return type->utoff;
+    }
+
+    /**
+    * @brief Convert an instant to broken-down local time, equivalent to localtime_r() with TZ set
+    * @param[in] utc - Seconds since the epoch
+    * @param[out] out - Local time; tm_gmtoff and tm_zone are not filled in
+    */
+    void localTime(int64_t utc, struct tm& out) const
+    {
+        bool isdst = false;
+        int64_t local = utc + offsetAt(utc, &isdst);
+        int64_t days = floorDiv(local, 86400);
+        int64_t secs = local - days * 86400;
+        int year = 0, month = 0, day = 0;
+        civilFromDays(days, year, month, day);
+
+        memset(&out, 0, sizeof(out));
+        out.tm_year = year - 1900;
+        out.tm_mon = month - 1;
+        out.tm_mday = day;
+        out.tm_hour = (int)(secs / 3600);
+        out.tm_min = (int)(secs % 3600 / 60);
+        out.tm_sec = (int)(secs % 60);
+        out.tm_wday = (int)((days % 7 + 11) % 7); /* 1970-01-01 was a Thursday */
+        out.tm_yday = (int)(days - daysFromCivil(year, 1, 1));
+        out.tm_isdst = isdst ? 1 : 0;
+    }
+
+    /**
+    * @brief Convert a local date and time to an instant, equivalent to "TZ=<zone> date -d 'Y-M-D h:m:s' +%s"
+    *
+    * A time repeated when clocks go back resolves to its first occurrence. A time skipped when
+    * clocks go forward is read with the offset in effect before the change, so 02:30 on a
+    * spring-forward night becomes 03:30 of the new offset.
+    * Out of range fields are normalised, so day 32 is the first of the next month.
+    *
+    * @return Seconds since the epoch
+    */
+    int64_t toUtc(int year, int month, int day, int hour, int minute, int second) const
+    {
+        int64_t local = localSeconds(year, month, day, hour, minute, second);
+        int32_t before = offsetAt(local - 86400);
+        int32_t after = offsetAt(local + 86400);
+
+        int64_t best = 0;
+        bool found = false;
+        const int32_t candidates[] = { before, after };
+        for (int32_t offset : candidates)
+        {
+            int64_t utc = local - offset;
+            if (offsetAt(utc) == offset && (!found || utc < best))
+            {
+                best = utc;
+                found = true;
+            }
+        }
+        return found ? best : local - before;
+    }
+
+    /**
+    * @brief Whether the zone was loaded from a zoneinfo file or a POSIX TZ string, as opposed to the UTC fallback
+    */
+    bool isValid() const
+    {
+        return _valid;
+    }
+
+    static int64_t daysFromCivil(int64_t year, int64_t month, int64_t day)
+    {
+        year -= month <= 2;
+        int64_t era = floorDiv(year, 400);
+        int64_t yoe = year - era * 400;
+        int64_t doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+        int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+    static void civilFromDays(int64_t days, int& year, int& month, int& day)
+    {
+        days += 719468;
+        int64_t era = floorDiv(days, 146097);
+        int64_t doe = days - era * 146097;
+        int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        int64_t mp = (5 * doy + 2) / 153;
+        day = (int)(doy - (153 * mp + 2) / 5 + 1);
+        month = (int)(mp < 10 ? mp + 3 : mp - 9);
+        year = (int)(yoe + era * 400 + (month <= 2));
+    }
+
+private:
+    struct Type
+    {
+        int32_t utoff;
+        bool isdst;
+    };
+
+    /* One end of a POSIX TZ daylight saving rule */
+    struct RuleDate
+    {
+        char kind; /* 'J' Julian day 1-365 without Feb 29, 'D' zero based day 0-365, 'M' month.week.day */
+        int day;
+        int week;
+        int month;
+        int32_t time; /* seconds after local midnight */
+    };
+
+    TimeZone()
+    {
+        reset();
+    }
+
+    void reset()
+    {
+        _transitions.clear();
+        _typeIndex.clear();
+        _types.assign(1, Type { 0, false });
+        _hasRule = false;
+        _valid = false;
+        _stdOffset = 0;
+        _dstOffset = 0;
+        _hasDst = false;
+    }
+
+    static int64_t floorDiv(int64_t a, int64_t b)
+    {
+        return (a >= 0) ? a / b : -((-a + b - 1) / b);
+    }
+
+    static int64_t localSeconds(int year, int month, int day, int hour, int minute, int second)
+    {
+        /* normalise the month first so that daysFromCivil() gets 1-12 */
+        int64_t m = month - 1;
+        int64_t y = year + floorDiv(m, 12);
+        m = m - floorDiv(m, 12) * 12 + 1;
+        return (daysFromCivil(y, m, 1) + day - 1) * 86400 + (int64_t)hour * 3600 + (int64_t)minute * 60 + second;
+    }
+
+    static bool isLeap(int64_t year)
+    {
+        return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    }
+
+    static std::string filePath(const std::string& name)
+    {
+        std::string file = (!name.empty() && name[0] == ':') ? name.substr(1) : name;
+        if (file.empty() || file.find("..") != std::string::npos)
+        {
+            return std::string();
+        }
+        if (file[0] == '/')
+        {
+            return file;
+        }
+        const char* dir = getenv("TZDIR");
+        return std::string((dir != nullptr && *dir != '\0') ? dir : ZONEINFO_DIR) + "/" + file;
+    }
+
+    static int64_t readBE(const unsigned char* p, int size)
+    {
+        uint64_t value = 0;
+        for (int i = 0; i < size; i++)
+        {
+            value = (value << 8) | p[i];
+        }
+        /* sign extend */
+        if (size < 8 && (value & (1ULL << (size * 8 - 1))))
+        {
+            value |= ~0ULL << (size * 8);
+        }
+        return (int64_t)value;
+    }
+
+    bool loadFile(const std::string& path)
+    {
+        std::ifstream file(path.c_str(), std::ios::in | std::ios::binary);
+        if (!file.is_open())
+        {
+            return false;
+        }
+        std::string data;
+        char buffer[4096];
+        while (file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+        {
+            data.append(buffer, file.gcount());
+            if (data.size() > ZONEINFO_MAX_FILE_SIZE)
+            {
+                return false;
+            }
+        }
+
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(data.data());
+        size_t size = data.size();
+        size_t pos = 0;
+        bool ok = parseBlock(p, size, pos, 4);
+        if (ok && data[4] >= '2')
+        {
+            /* version 2+: the 64-bit block and the POSIX TZ footer follow the 32-bit block */
+            ok = parseBlock(p, size, pos, 8);
+            if (ok && pos < size && data[pos] == '\n')
+            {
+                /* without a usable footer the last transition stays in effect */
+                size_t end = data.find('\n', pos + 1);
+                if (end != std::string::npos && end > pos + 1)
+                {
+                    parseRule(data.substr(pos + 1, end - pos - 1));
+                }
+            }
+        }
+        _valid = ok;
+        return ok;
+    }
+
+    bool parseBlock(const unsigned char* p, size_t size, size_t& pos, int timeSize)
+    {
+        if (size < pos + 44 || memcmp(p + pos, "TZif", 4) != 0)
+        {
+            return false;
+        }
+        int64_t isutcnt = readBE(p + pos + 20, 4);
+        int64_t isstdcnt = readBE(p + pos + 24, 4);
+        int64_t leapcnt = readBE(p + pos + 28, 4);
+        int64_t timecnt = readBE(p + pos + 32, 4);
+        int64_t typecnt = readBE(p + pos + 36, 4);
+        int64_t charcnt = readBE(p + pos + 40, 4);
+        pos += 44;
+        if (isutcnt < 0 || isstdcnt < 0 || leapcnt < 0 || timecnt < 0 || typecnt <= 0 || charcnt < 0)
+        {
+            return false;
+        }
+
+        size_t need = timecnt * timeSize + timecnt + typecnt * 6 + charcnt + leapcnt * (timeSize + 4) + isstdcnt + isutcnt;
+        if (size < pos + need)
+        {
+            return false;
+        }
+
+        std::vector<int64_t> transitions(timecnt);
+        std::vector<uint8_t> typeIndex(timecnt);
+        std::vector<Type> types(typecnt);
+        for (int64_t i = 0; i < timecnt; i++)
+        {
+            transitions[i] = readBE(p + pos + i * timeSize, timeSize);
+        }
+        pos += timecnt * timeSize;
+        for (int64_t i = 0; i < timecnt; i++)
+        {
+            typeIndex[i] = p[pos + i];
+            if (typeIndex[i] >= typecnt)
+            {
+                return false;
+            }
+        }
+        pos += timecnt;
+        for (int64_t i = 0; i < typecnt; i++)
+        {
+            types[i].utoff = (int32_t)readBE(p + pos + i * 6, 4);
+            types[i].isdst = p[pos + i * 6 + 4] != 0;
+        }
+        pos += typecnt * 6 + charcnt + leapcnt * (timeSize + 4) + isstdcnt + isutcnt;
+
+        _transitions.swap(transitions);
+        _typeIndex.swap(typeIndex);
+        _types.swap(types);
+        return true;
+    }
+
+    /* POSIX TZ string, e.g. "EST5EDT,M3.2.0,M11.1.0" or "<+0530>-5:30" */
+    bool parseRule(const std::string& rule)
+    {
+        const char* s = rule.c_str();
+        int32_t offset = 0;
+        if (!parseName(s) || !parseOffset(s, offset))
+        {
+            return false;
+        }
+        _stdOffset = -offset;
+        _dstOffset = _stdOffset;
+        _hasDst = false;
+
+        if (*s != '\0')
+        {
+            if (!parseName(s))
+            {
+                return false;
+            }
+            _hasDst = true;
+            _dstOffset = _stdOffset + 3600;
+            if (*s != ',' && *s != '\0')
+            {
+                if (!parseOffset(s, offset))
+                {
+                    return false;
+                }
+                _dstOffset = -offset;
+            }
+            if (*s == '\0')
+            {
+                /* no rule given; use the US rules like glibc's posixrules default */
+                _start = RuleDate { 'M', 0, 2, 3, 7200 };
+                _end = RuleDate { 'M', 0, 1, 11, 7200 };
+            }
+            else if (!(*s++ == ',' && parseDate(s, _start) && *s++ == ',' && parseDate(s, _end) && *s == '\0'))
+            {
+                return false;
+            }
+        }
+        _hasRule = true;
+        _valid = true;
+        return true;
+    }
+
+    static bool parseName(const char*& s)
+    {
+        const char* start = s;
+        if (*s == '<')
+        {
+            while (*s != '\0' && *s != '>')
+            {
+                s++;
+            }
+            if (*s != '>')
+            {
+                return false;
+            }
+            s++;
+            return (s - start) >= 5;
+        }
+        while ((*s >= 'A' && *s <= 'Z') || (*s >= 'a' && *s <= 'z'))
+        {
+            s++;
+        }
+        return (s - start) >= 3;
+    }
+
+    /* [+|-]hh[:mm[:ss]], positive west of Greenwich */
+    static bool parseOffset(const char*& s, int32_t& value)
+    {
+        int sign = 1;
+        if (*s == '+' || *s == '-')
+        {
+            sign = (*s == '-') ? -1 : 1;
+            s++;
+        }
+        if (*s < '0' || *s > '9')
+        {
+            return false;
+        }
+        int32_t parts[3] = { 0, 0, 0 };
+        for (int i = 0; i < 3; i++)
+        {
+            char* end = nullptr;
+            parts[i] = (int32_t)strtol(s, &end, 10);
+            if (end == s)
+            {
+                return false;
+            }
+            s = end;
+            if (*s != ':')
+            {
+                break;
+            }
+            s++;
+        }
+        if (parts[0] > 167 || parts[1] > 59 || parts[2] > 59)
+        {
+            return false;
+        }
+        value = sign * (parts[0] * 3600 + parts[1] * 60 + parts[2]);
+        return true;
+    }
+
+    static bool parseDate(const char*& s, RuleDate& date)
+    {
+        char* end = nullptr;
+        date.time = 7200;
+        if (*s == 'M')
+        {
+            date.kind = 'M';
+            date.month = (int)strtol(s + 1, &end, 10);
+            if (*end != '.')
+            {
+                return false;
+            }
+            date.week = (int)strtol(end + 1, &end, 10);
+            if (*end != '.')
+            {
+                return false;
+            }
+            date.day = (int)strtol(end + 1, &end, 10);
+            if (date.month < 1 || date.month > 12 || date.week < 1 || date.week > 5 || date.day < 0 || date.day > 6)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            date.kind = (*s == 'J') ? 'J' : 'D';
+            const char* digits = (*s == 'J') ? s + 1 : s;
+            date.day = (int)strtol(digits, &end, 10);
+            if (end == digits || date.day < (date.kind == 'J' ? 1 : 0) || date.day > 365)
+            {
+                return false;
+            }
+        }
+        s = end;
+        if (*s == '/')
+        {
+            s++;
+            return parseOffset(s, date.time);
+        }
+        return true;
+    }
+
+    /* Seconds since the epoch of a rule date in local time of the given year */
+    static int64_t ruleLocalTime(const RuleDate& date, int64_t year)
+    {
+        int64_t days = 0;
+        if (date.kind == 'J')
+        {
+            days = daysFromCivil(year, 1, 1) + date.day - 1 + ((isLeap(year) && date.day >= 60) ? 1 : 0);
+        }
+        else if (date.kind == 'D')
+        {
+            days = daysFromCivil(year, 1, 1) + date.day;
+        }
+        else
+        {
+            static const int monthDays[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+            int64_t first = daysFromCivil(year, date.month, 1);
+            int firstWeekday = (int)((first % 7 + 11) % 7);
+            int mday = 1 + (date.day - firstWeekday + 7) % 7 + (date.week - 1) * 7;
+            int length = monthDays[date.month - 1] + ((date.month == 2 && isLeap(year)) ? 1 : 0);
+            while (mday > length)
+            {
+                mday -= 7;
+            }
+            days = first + mday - 1;
+        }
+        return days * 86400 + date.time;
+    }
+
+    int32_t ruleOffsetAt(int64_t utc, bool* isdst) const
+    {
+        bool dst = false;
+        if (_hasDst)
+        {
+            int year = 0, month = 0, day = 0;
+            civilFromDays(floorDiv(utc + _stdOffset, 86400), year, month, day);
+            int64_t start = ruleLocalTime(_start, year) - _stdOffset;
+            int64_t end = ruleLocalTime(_end, year) - _dstOffset;
+            dst = (start < end) ? (utc >= start && utc < end) : !(utc >= end && utc < start);
+        }
+        if (isdst != nullptr)
+        {
+            *isdst = dst;
+        }
+        return dst ? _dstOffset : _stdOffset;
+    }
+
+    std::string _stamp;
+    std::vector<int64_t> _transitions;
+    std::vector<uint8_t> _typeIndex;
+    std::vector<Type> _types;
+    bool _valid;
+    bool _hasRule;
+    bool _hasDst;
+    int32_t _stdOffset;
+    int32_t _dstOffset;
+    RuleDate _start;
+    RuleDate _end;
+};
+} // namespace Utils
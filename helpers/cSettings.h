@@ -24,6 +24,12 @@
 #include <plugins/plugins.h>
 #include <stdlib.h>
 #include <string>
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <libgen.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "UtilsfileExists.h"
 
@@ -32,6 +38,8 @@ using namespace std;
 class cSettings {
     std::string filename;
     JsonObject data;
+    unsigned int transactionDepth = 0;
+    bool dirty = false;
 
 public:
     /***
@@ -153,31 +161,118 @@ public:
         return status;
     }
 
+    /***
+     * @brief    : Start a transaction. setValue() and remove() only update
+     *             the in-memory values until the matching commit().
+     *             Transactions nest; the outermost commit() writes the file.
+     * @return   : nil.
+     */
+    void begin()
+    {
+        transactionDepth++;
+    }
+
+    /***
+     * @brief    : End a transaction, writing the file once if anything changed.
+     * @return   : <bool> False if the file couldn't be written, else True.
+     */
+    bool commit()
+    {
+        if (transactionDepth == 0) {
+            return false;
+        }
+        if (--transactionDepth > 0 || !dirty) {
+            return true;
+        }
+        dirty = false;
+        return writeToFile();
+    }
+
     /***
      * @brief    : Update new inserts into the json object onto file.
-     * @return   : <bool> False if timer thread couldn't be started.
+     *             The file is replaced atomically: the values are written to a
+     *             temporary file, flushed to storage and renamed over it, and
+     *             the rename is flushed with the directory, so a power cut
+     *             leaves either the old or the new contents. The file keeps
+     *             its mode and, where permitted, its owner.
+     * @return   : <bool> False if the file couldn't be written, else True.
      */
     bool writeToFile()
     {
-        bool status = false;
+        if (transactionDepth > 0) {
+            dirty = true;
+            return true;
+        }
+        if (!Utils::fileExists(filename.c_str())) {
+            return false;
+        }
+
+        std::string content;
+        JsonObject::Iterator iterator = data.Variants();
+        while (iterator.Next()) {
+            if (!data[iterator.Label()].String().empty()) {
+                content += std::string(iterator.Label()) + "=" + data[iterator.Label()].String() + "\n";
+            }
+        }
 
-        if (Utils::fileExists(filename.c_str())) {
-            ofstream ofile;
-            ofile.open(filename.c_str(), ios::out);
-            if (ofile) {
-                JsonObject::Iterator iterator = data.Variants();
-                while (iterator.Next()) {
-                    if (!data[iterator.Label()].String().empty()) {
-                        ofile << iterator.Label() << "=" << data[iterator.Label()].String() << endl;
-                    } else {
-                        continue;
-                    }
+        struct stat original;
+        if (stat(filename.c_str(), &original) != 0) {
+            return false;
+        }
+
+        std::string tmpname = filename + ".tmp";
+        int fd = open(tmpname.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            std::cout << "Error:[cSettings] unable to open " << tmpname << std::endl;
+            return false;
+        }
+
+        bool status = true;
+        /* Only root may give the file away; a caller that owns it keeps it anyway */
+        if (fchown(fd, original.st_uid, original.st_gid) != 0 && errno != EPERM) {
+            status = false;
+        }
+        if (status && fchmod(fd, original.st_mode & 07777) != 0) {
+            status = false;
+        }
+        const char* ptr = content.data();
+        size_t left = content.size();
+        while (status && left > 0) {
+            ssize_t written = write(fd, ptr, left);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
                 }
-                status = true;
-                ofile.close();
-            } else {
                 status = false;
+                break;
             }
+            ptr += written;
+            left -= written;
+        }
+        if (status && fdatasync(fd) != 0) {
+            status = false;
+        }
+        if (close(fd) != 0) {
+            status = false;
+        }
+        if (status && rename(tmpname.c_str(), filename.c_str()) != 0) {
+            status = false;
+        }
+        if (!status) {
+            std::cout << "Error:[cSettings] unable to write " << filename << std::endl;
+            unlink(tmpname.c_str());
+            return false;
+        }
+
+        /* The new name is only durable once the directory holding it is */
+        std::string dirpath = filename;
+        int dirfd = open(dirname(&dirpath[0]), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (dirfd < 0 || fsync(dirfd) != 0) {
+            std::cout << "Error:[cSettings] unable to sync the directory of " << filename << std::endl;
+            status = false;
+        }
+        if (dirfd >= 0) {
+            close(dirfd);
         }
         return status;
     }